@@ -0,0 +1,236 @@
+/**
+ * Copyright © 2024 Austin Berrio
+ *
+ * @file bench/bench_lehmer.c
+ *
+ * @brief Microbenchmark suite for the Lehmer LCG PRNG API.
+ *
+ * Measures ns/draw and draws/sec for every seed generator, sequence fill
+ * throughput as a function of length, and the variate functions. Results
+ * are printed as human-readable lines on stderr and as a JSON document on
+ * stdout so they can be tracked over time.
+ *
+ * @note Keep benchmarks honest: accumulate every generated value into a
+ * sink so the compiler cannot dead-code-eliminate the measured loop.
+ */
+
+// Expose clock_gettime and CLOCK_MONOTONIC under strict C
+#define _POSIX_C_SOURCE 199309L
+
+#include "lehmer.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @param BENCH_DRAWS Number of draws per generator benchmark.
+ */
+#define BENCH_DRAWS 10000000
+
+/**
+ * @param BENCH_VARIATE_DRAWS Number of draws per variate benchmark.
+ */
+#define BENCH_VARIATE_DRAWS 1000000
+
+// Sink that keeps the measured loops observable
+static volatile int64_t bench_sink = 0;
+
+// Monotonic wall clock in nanoseconds
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// Tracks whether a comma is needed between JSON entries
+static bool bench_first_entry = true;
+
+// Report one benchmark as a stderr line and a JSON object on stdout
+static void bench_report(const char* name, uint64_t iterations, uint64_t ns) {
+    double ns_per_op = (double) ns / (double) iterations;
+    double ops_per_sec = 1e9 / ns_per_op;
+
+    fprintf(
+        stderr,
+        "%-32s %12.2f ns/op %15.0f ops/sec\n",
+        name,
+        ns_per_op,
+        ops_per_sec
+    );
+
+    if (!bench_first_entry) {
+        printf(",\n");
+    }
+    bench_first_entry = false;
+
+    printf(
+        "    {\"name\": \"%s\", \"iterations\": %llu, "
+        "\"ns_per_op\": %.4f, \"ops_per_sec\": %.0f}",
+        name,
+        (unsigned long long) iterations,
+        ns_per_op,
+        ops_per_sec
+    );
+}
+
+// Benchmark a raw seed generator callback
+static void bench_generator(const char* name, lehmer_generate_t generator) {
+    int32_t seed = LEHMER_SEED;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_DRAWS; i++) {
+        seed = generator(seed);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += seed;
+    bench_report(name, BENCH_DRAWS, elapsed);
+}
+
+// Benchmark the sequence fill for a given length
+static void bench_generate_fill(uint32_t length) {
+    char name[64];
+    snprintf(name, sizeof(name), "lehmer_generate/%u", length);
+
+    lehmer_state_t* state = lehmer_state_create(LEHMER_SEED, length);
+    if (NULL == state) {
+        return;
+    }
+
+    // Fill enough times to amortize timer resolution at small lengths
+    uint32_t rounds = (BENCH_DRAWS / length) > 0 ? (BENCH_DRAWS / length) : 1;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < rounds; i++) {
+        lehmer_generate(state, lehmer_generate_modulo, LEHMER_SEED);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += state->sequence[length - 1];
+    bench_report(name, (uint64_t) rounds * length, elapsed);
+
+    lehmer_state_free(state);
+}
+
+// Benchmark the per-call float variate path
+static void bench_random_modulo(void) {
+    lehmer_state_t* state = lehmer_state_create(LEHMER_SEED, LEHMER_SIZE);
+    float sum = 0.0f;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_VARIATE_DRAWS; i++) {
+        sum += lehmer_random_modulo(state);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += (int64_t) sum;
+    bench_report("lehmer_random_modulo", BENCH_VARIATE_DRAWS, elapsed);
+
+    lehmer_state_free(state);
+}
+
+// Benchmark the lean single-seed variate path
+static void bench_random_lean(void) {
+    lehmer_state_t* state = lehmer_state_create_lean(LEHMER_SEED);
+    float sum = 0.0f;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_VARIATE_DRAWS; i++) {
+        sum += lehmer_random_lean(state);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += (int64_t) sum;
+    bench_report("lehmer_random_lean", BENCH_VARIATE_DRAWS, elapsed);
+
+    lehmer_state_free(state);
+}
+
+// Benchmark the bulk fill variate path
+static void bench_random_fill(void) {
+    lehmer_state_t* state = lehmer_state_create(LEHMER_SEED, LEHMER_SIZE);
+    static float buffer[65536];
+    uint32_t rounds = BENCH_DRAWS / 65536;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < rounds; i++) {
+        lehmer_random_fill(state, buffer, 65536);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += (int64_t) buffer[0];
+    bench_report("lehmer_random_fill", (uint64_t) rounds * 65536, elapsed);
+
+    lehmer_state_free(state);
+}
+
+// Benchmark the 64-bit engine
+static void bench_random_64(void) {
+    lehmer64_state_t* state = lehmer64_state_create(LEHMER64_SEED);
+    double sum = 0.0;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_VARIATE_DRAWS; i++) {
+        sum += lehmer64_random(state);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += (int64_t) sum;
+    bench_report("lehmer64_random", BENCH_VARIATE_DRAWS, elapsed);
+
+    lehmer64_state_free(state);
+}
+
+// Benchmark the probability variates
+static void bench_variates(void) {
+    lehmer_state_t* state = lehmer_state_create(LEHMER_SEED, LEHMER_SIZE);
+    int64_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_VARIATE_DRAWS; i++) {
+        sum += lehmer_bernoulli(state, 0.5f);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_sink += sum;
+    bench_report("lehmer_bernoulli", BENCH_VARIATE_DRAWS, elapsed);
+
+    sum = 0;
+    start = bench_now_ns();
+    for (uint32_t i = 0; i < BENCH_VARIATE_DRAWS / 10; i++) {
+        sum += lehmer_binomial(state, 10, 0.5f);
+    }
+    elapsed = bench_now_ns() - start;
+    bench_sink += sum;
+    bench_report("lehmer_binomial/10", BENCH_VARIATE_DRAWS / 10, elapsed);
+
+    lehmer_state_free(state);
+}
+
+int main(void) {
+    printf("{\n  \"benchmarks\": [\n");
+
+    // Raw seed generators
+    bench_generator("lehmer_generate_modulo", lehmer_generate_modulo);
+    bench_generator("lehmer_generate_gamma", lehmer_generate_gamma);
+    bench_generator("lehmer_generate_jump", lehmer_generate_jump);
+    bench_generator("lehmer_generate_delta", lehmer_generate_delta);
+    bench_generator("lehmer_generate_binder", lehmer_generate_binder);
+
+    // Sequence fill throughput as a function of length
+    bench_generate_fill(256);
+    bench_generate_fill(4096);
+    bench_generate_fill(65536);
+    bench_generate_fill(1048576);
+
+    // Variate paths
+    bench_random_modulo();
+    bench_random_lean();
+    bench_random_fill();
+    bench_random_64();
+    bench_variates();
+
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
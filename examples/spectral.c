@@ -0,0 +1,189 @@
+/**
+ * Copyright © 2024 Austin Berrio
+ *
+ * @file examples/spectral.c
+ *
+ * @brief Multiplier quality search: spectral tests and period checks over a
+ * prime candidate table, emitting a ranked report.
+ *
+ * The comment block above LEHMER_MULTIPLIER debates several candidates
+ * (16763, 16787, 16811, 48271, and the jump candidates 8423, 8429, 8431).
+ * This tool evaluates every prime candidate from prime_sample_create()
+ * against two criteria:
+ *
+ * - Full period: a is a primitive root modulo m, checked by verifying
+ *   a^((m - 1) / p) != 1 for every prime factor p of m - 1.
+ * - 2D spectral merit: the shortest nonzero vector of the lattice of
+ *   successive pairs (z, a * z mod m), found with Gauss reduction and
+ *   normalized against the theoretical optimum (4/3)^(1/4) * sqrt(m).
+ *
+ * @ref The Art of Computer Programming, Volume 2
+ * @cite 3.3.4: The Spectral Test
+ */
+
+#include "lehmer.h"
+#include "prime.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CANDIDATE_LIMIT 65536
+#define REPORT_LIMIT 10
+
+// The prime factorization of m - 1 = 2^31 - 2 = 2 * 3^2 * 7 * 11 * 31 * 151 * 331
+static const uint32_t factors[] = {2, 3, 7, 11, 31, 151, 331};
+
+// The candidates debated in the LEHMER_MULTIPLIER comment block
+static const uint32_t debated[] = {8423, 8429, 8431, 16763, 16787, 16811, 48271};
+
+typedef struct Candidate {
+    uint32_t multiplier;
+    double merit; // 2D spectral merit in (0, 1]; higher is better
+} candidate_t;
+
+// A multiplier has full period iff it is a primitive root modulo m
+static bool candidate_has_full_period(
+    const prime_modexp_ctx_t* ctx, uint32_t a
+) {
+    for (size_t i = 0; i < sizeof(factors) / sizeof(factors[0]); i++) {
+        if (1 == prime_modexp(ctx, a, (LEHMER_MODULUS - 1) / factors[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Shortest nonzero lattice vector of {(z, a * z mod m)} via Gauss reduction
+static double candidate_spectral_merit(uint32_t a, uint32_t m) {
+    // Basis: (1, a) and (0, m); every successive pair is a combination
+    int64_t u1 = 1, u2 = a;
+    int64_t v1 = 0, v2 = m;
+    int64_t norm_u = u1 * u1 + u2 * u2;
+    int64_t norm_v = v1 * v1 + v2 * v2;
+
+    for (;;) {
+        if (norm_v < norm_u) {
+            int64_t swap;
+            swap = u1, u1 = v1, v1 = swap;
+            swap = u2, u2 = v2, v2 = swap;
+            swap = norm_u, norm_u = norm_v, norm_v = swap;
+        }
+
+        // Reduce v against u by the rounded projection coefficient
+        int64_t q = llround((double) (u1 * v1 + u2 * v2) / (double) norm_u);
+        if (0 == q) {
+            break;
+        }
+
+        v1 -= q * u1;
+        v2 -= q * u2;
+        norm_v = v1 * v1 + v2 * v2;
+        if (norm_v >= norm_u) {
+            break;
+        }
+    }
+
+    // Normalize against the densest possible 2D lattice packing
+    double nu2 = sqrt((double) norm_u);
+    return nu2 / (pow(4.0 / 3.0, 0.25) * sqrt((double) m));
+}
+
+// Sort candidates by descending spectral merit
+static int candidate_compare(const void* lhs, const void* rhs) {
+    const candidate_t* a = (const candidate_t*) lhs;
+    const candidate_t* b = (const candidate_t*) rhs;
+
+    if (a->merit < b->merit) {
+        return 1;
+    }
+    if (a->merit > b->merit) {
+        return -1;
+    }
+    return 0;
+}
+
+int main(void) {
+    prime_sample_t* sample = prime_sample_create(CANDIDATE_LIMIT);
+    if (NULL == sample) {
+        fprintf(stderr, "Failed to create the prime candidate table.\n");
+        return 1;
+    }
+
+    prime_modexp_ctx_t ctx;
+    if (!prime_modexp_ctx_init(&ctx, LEHMER_MODULUS)) {
+        fprintf(stderr, "Failed to initialize the modexp context.\n");
+        prime_sample_free(sample);
+        return 1;
+    }
+
+    candidate_t* ranked
+        = (candidate_t*) malloc(sample->size * sizeof(candidate_t));
+    if (NULL == ranked) {
+        fprintf(stderr, "Failed to allocate the candidate ranking.\n");
+        prime_sample_free(sample);
+        return 1;
+    }
+
+    // Keep only full-period candidates; a short period disqualifies outright
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < sample->size; i++) {
+        uint32_t a = (uint32_t) sample->data[i];
+        if (!candidate_has_full_period(&ctx, a)) {
+            continue;
+        }
+        ranked[count].multiplier = a;
+        ranked[count].merit = candidate_spectral_merit(a, LEHMER_MODULUS);
+        count++;
+    }
+
+    qsort(ranked, count, sizeof(candidate_t), candidate_compare);
+
+    printf(
+        "Scanned %u prime candidates below %u: %u have full period.\n\n",
+        sample->size,
+        (uint32_t) CANDIDATE_LIMIT,
+        count
+    );
+
+    printf("Top %u by 2D spectral merit:\n", (uint32_t) REPORT_LIMIT);
+    for (uint32_t i = 0; i < count && i < REPORT_LIMIT; i++) {
+        printf(
+            "%4u. a = %6u, merit = %.6f\n",
+            i + 1,
+            ranked[i].multiplier,
+            ranked[i].merit
+        );
+    }
+
+    printf("\nDebated candidates:\n");
+    for (size_t i = 0; i < sizeof(debated) / sizeof(debated[0]); i++) {
+        uint32_t a = debated[i];
+
+        if (!candidate_has_full_period(&ctx, a)) {
+            printf("      a = %6u: not full period\n", a);
+            continue;
+        }
+
+        // Recover the candidate's rank within the full-period field
+        double merit = candidate_spectral_merit(a, LEHMER_MODULUS);
+        uint32_t rank = 1;
+        for (uint32_t j = 0; j < count; j++) {
+            if (ranked[j].merit > merit) {
+                rank++;
+            }
+        }
+        printf(
+            "      a = %6u: merit = %.6f (rank %u of %u)\n",
+            a,
+            merit,
+            rank,
+            count
+        );
+    }
+
+    free(ranked);
+    prime_sample_free(sample);
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * Copyright © 2024 Austin Berrio
+ *
+ * @file examples/validate_lehmer.c
+ *
+ * @brief Statistical validation harness for the generator variants.
+ *
+ * Streams draws straight off the recurrence through chi-square,
+ * Kolmogorov-Smirnov, and 2D equidistribution (serial pair) checks with
+ * O(1) memory: every statistic lives in a fixed set of streaming bin
+ * accumulators, so the harness keeps up with the generator it validates
+ * instead of materializing sequences for offline analysis.
+ *
+ * The exit status counts failed checks among the uniform variants
+ * (modulo, gamma, jump). The delta and binder variants are reported for
+ * reference; they are auxiliary functions, not uniform generators.
+ *
+ * @ref The Art of Computer Programming, Volume 2
+ * @cite 3.3.1: General Test Procedures for Studying Random Data
+ */
+
+#include "lehmer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DRAW_COUNT 1000000
+#define CHI_BINS 256
+#define PAIR_BINS 64
+#define KS_BINS 8192
+
+typedef struct Variant {
+    const char* name;
+    lehmer_generate_t generator;
+    bool uniform; // Whether the variant is expected to pass
+} variant_t;
+
+static const variant_t variants[] = {
+    {"modulo", lehmer_generate_modulo, true},
+    {"gamma", lehmer_generate_gamma, true},
+    {"jump", lehmer_generate_jump, true},
+    {"delta", lehmer_generate_delta, false},
+    {"binder", lehmer_generate_binder, false},
+};
+
+// Chi-square z-score against df = bins - 1 via the normal approximation
+static double chi_square_z(const uint64_t* bins, uint32_t count, uint64_t n) {
+    double expected = (double) n / count;
+    double statistic = 0.0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        double delta = (double) bins[i] - expected;
+        statistic += delta * delta / expected;
+    }
+
+    double df = (double) (count - 1);
+    return (statistic - df) / sqrt(2.0 * df);
+}
+
+// Kolmogorov-Smirnov statistic from binned edges, scaled by sqrt(n).
+// Binning under-reads the supremum by at most 1 / KS_BINS, which the
+// acceptance threshold absorbs.
+static double ks_statistic(const uint64_t* bins, uint64_t n) {
+    double supremum = 0.0;
+    uint64_t cumulative = 0;
+
+    for (uint32_t i = 0; i < KS_BINS; i++) {
+        cumulative += bins[i];
+        double edge = (double) (i + 1) / KS_BINS;
+        double gap = fabs((double) cumulative / n - edge);
+        if (gap > supremum) {
+            supremum = gap;
+        }
+    }
+
+    return supremum * sqrt((double) n);
+}
+
+// Run every check for one variant; returns the number of failed checks
+static uint32_t validate_variant(const variant_t* variant) {
+    static uint64_t chi_bins[CHI_BINS];
+    static uint64_t pair_bins[PAIR_BINS][PAIR_BINS];
+    static uint64_t ks_bins[KS_BINS];
+
+    memset(chi_bins, 0, sizeof(chi_bins));
+    memset(pair_bins, 0, sizeof(pair_bins));
+    memset(ks_bins, 0, sizeof(ks_bins));
+
+    // Stream the draws; nothing is materialized
+    int32_t seed = LEHMER_SEED;
+    double previous = 0.0;
+    for (uint64_t i = 0; i < DRAW_COUNT; i++) {
+        seed = variant->generator(seed);
+        double value = lehmer_seed_normalize_to_double(seed);
+
+        // Clamp pathological variants into [0, 1) instead of crashing
+        if (0.0 > value || 1.0 <= value) {
+            value = (0.0 > value) ? 0.0 : 0.9999999;
+        }
+
+        chi_bins[(uint32_t) (value * CHI_BINS)]++;
+        ks_bins[(uint32_t) (value * KS_BINS)]++;
+        if (0 < i) {
+            uint32_t row = (uint32_t) (previous * PAIR_BINS);
+            uint32_t col = (uint32_t) (value * PAIR_BINS);
+            pair_bins[row][col]++;
+        }
+        previous = value;
+    }
+
+    // Chi-square: the z-score should sit well inside +/- 4 sigma
+    uint32_t failures = 0;
+    double chi_z = chi_square_z(chi_bins, CHI_BINS, DRAW_COUNT);
+    bool chi_passed = fabs(chi_z) < 4.0;
+    failures += chi_passed ? 0 : 1;
+
+    // KS: critical value at alpha = 0.001 is 1.95; allow binning slack
+    double ks = ks_statistic(ks_bins, DRAW_COUNT);
+    bool ks_passed = ks < 2.2;
+    failures += ks_passed ? 0 : 1;
+
+    // Equidistribution of serial pairs, chi-square over the 2D grid
+    double pair_z
+        = chi_square_z(&pair_bins[0][0], PAIR_BINS * PAIR_BINS, DRAW_COUNT - 1);
+    bool pair_passed = fabs(pair_z) < 4.0;
+    failures += pair_passed ? 0 : 1;
+
+    printf(
+        "%-8s chi-square z = %8.3f [%s]  ks = %6.3f [%s]  pairs z = %8.3f "
+        "[%s]\n",
+        variant->name,
+        chi_z,
+        chi_passed ? "pass" : "FAIL",
+        ks,
+        ks_passed ? "pass" : "FAIL",
+        pair_z,
+        pair_passed ? "pass" : "FAIL"
+    );
+
+    return failures;
+}
+
+int main(void) {
+    printf(
+        "Validating %zu generator variants over %u draws each:\n\n",
+        sizeof(variants) / sizeof(variants[0]),
+        (uint32_t) DRAW_COUNT
+    );
+
+    uint32_t failures = 0;
+    for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++) {
+        uint32_t failed = validate_variant(&variants[i]);
+
+        // Only the uniform variants gate the exit status
+        if (variants[i].uniform) {
+            failures += failed;
+        }
+    }
+
+    printf("\n%u gating check(s) failed.\n", failures);
+
+    return (0 == failures) ? 0 : 1;
+}
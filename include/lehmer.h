@@ -94,6 +94,36 @@
  */
 #define LEHMER_SIZE 256
 
+/**
+ * @param LEHMER_LANES Number of independent lanes used by the vectorized
+ * sequence fill kernel.
+ *
+ * A Lehmer LCG admits log-time jump-ahead (a^k mod m), which lets the
+ * sequence fill be split into independent lanes advanced by the k-step
+ * multiplier. Each lane only depends on the element k positions behind it,
+ * so the compiler is free to vectorize the fill loop.
+ *
+ * @note Must be a power of two. 8 maps cleanly onto AVX2 and NEON widths.
+ */
+#define LEHMER_LANES 8
+
+/**
+ * @param LEHMER_CACHE_BUDGET Cache residency budget in bytes (default 256
+ * KiB, roughly half an L2 slice).
+ *
+ * Sequences whose storage fits the budget are treated as cache-resident:
+ * the read path issues a software prefetch for the next ring entry.
+ * Sequences above the budget are refilled with non-temporal stores where
+ * the target supports them, so a regeneration does not stream megabytes
+ * through L2/L3 and evict the caller's working set mid-timestep.
+ *
+ * @note Override at compile time (-DLEHMER_CACHE_BUDGET=...) to match the
+ * deployment cache hierarchy.
+ */
+#ifndef LEHMER_CACHE_BUDGET
+#define LEHMER_CACHE_BUDGET (1U << 18)
+#endif // LEHMER_CACHE_BUDGET
+
 /**
  * @param LEHMER_SEED Default seed value.
  *
@@ -117,6 +147,30 @@
  */
 #define LEHMER_REMAINDER ((LEHMER_MODULUS) % (LEHMER_MULTIPLIER))
 
+#ifdef LEHMER_ENABLE_STATS
+/**
+ * @brief Per-state instrumentation counters (opt-in).
+ *
+ * Compiled in only under -DLEHMER_ENABLE_STATS so the default build pays
+ * nothing. The counters live inside the state they describe, so updating
+ * them touches a cache line the draw already owns.
+ *
+ * draws counts emitted values across every path that advances the
+ * stream — per-call draws, fills, variates, shuffles, sampling, and
+ * streaming output. Rejection retries (bounded draws, ziggurat wedges)
+ * consume extra recurrence steps that are not counted separately.
+ *
+ * @param draws The number of values drawn from the stream.
+ * @param regenerations The number of lehmer_regenerate() calls.
+ * @param wraps The number of times the cursor crossed the ring boundary.
+ */
+typedef struct LehmerStats {
+    uint64_t draws; // The number of values drawn from the stream
+    uint64_t regenerations; // The number of lehmer_regenerate() calls
+    uint64_t wraps; // Cursor crossings of the ring boundary
+} lehmer_stats_t;
+#endif // LEHMER_ENABLE_STATS
+
 /**
  * @brief Structure representing the state of the Lehmer Random Number
  * Generator (LCG RNG).
@@ -131,14 +185,42 @@
  * @param sequence The sequence of generated integers.
  * @param length The number of values to generate.
  * @param position The current position in the sequence.
+ * @param filled High-water mark of materialized sequence entries.
+ * @param mask Cursor mask (length - 1) when length is a power of two.
+ * @param scalar Inline storage for the lean (single-seed) mode.
  */
 typedef struct LehmerState {
     int32_t seed; // The initial seed used to start the sequence
     int32_t* sequence; // The sequence of generated integers
     uint32_t length; // The number of values to generate
     uint32_t position; // The current position in the sequence
+    uint32_t filled; // High-water mark of materialized entries
+    uint32_t mask; // Cursor mask for power-of-two lengths, else 0
+    int32_t scalar; // Inline storage for the lean (single-seed) mode
+#ifdef LEHMER_ENABLE_STATS
+    lehmer_stats_t stats; // Opt-in instrumentation counters
+#endif
 } lehmer_state_t;
 
+#ifdef LEHMER_ENABLE_STATS
+/**
+ * @brief Toggle counter updates at runtime.
+ *
+ * Counting defaults to enabled when the instrumentation is compiled in.
+ *
+ * @param enabled Whether counters should accumulate.
+ */
+void lehmer_stats_toggle(bool enabled);
+
+/**
+ * @brief Print per-state counters and their totals to standard error.
+ *
+ * @param states An array of state pointers to aggregate.
+ * @param count The number of states in the array.
+ */
+void lehmer_stats_report(lehmer_state_t* const* states, uint32_t count);
+#endif // LEHMER_ENABLE_STATS
+
 /**
  * @brief Callback function for generating new seeds in the Lehmer RNG.
  *
@@ -146,6 +228,39 @@ typedef struct LehmerState {
  */
 typedef int32_t (*lehmer_generate_t)(int32_t);
 
+// Lehmer compile-time specialization
+
+/**
+ * @brief Stamp out a specialized inline modulo generator for a given (a, m).
+ *
+ * The generic path funnels through a lehmer_generate_t function pointer,
+ * which defeats inlining and constant propagation of the multiplier and
+ * modulus. This macro defines a static inline function where both are
+ * compile-time constants, so the recurrence compiles down to a single
+ * multiply and reduction.
+ *
+ * @param name The name of the generated function.
+ * @param a The multiplier (compile-time constant).
+ * @param m The modulus (compile-time constant).
+ */
+#define LEHMER_SPECIALIZE_MODULO(name, a, m) \
+    static inline int32_t name(int32_t seed) { \
+        return (int32_t) (((int64_t) (a) * seed) % (m)); \
+    }
+
+/**
+ * @brief Specialized inline core for the default a = 48271, m = 2^31 - 1
+ * recurrence.
+ */
+LEHMER_SPECIALIZE_MODULO(
+    lehmer_inline_modulo, LEHMER_MULTIPLIER, LEHMER_MODULUS
+)
+
+/**
+ * @brief Specialized inline core for the jump multiplier.
+ */
+LEHMER_SPECIALIZE_MODULO(lehmer_inline_jump, LEHMER_JUMP, LEHMER_MODULUS)
+
 // Lehmer state management
 
 /**
@@ -160,6 +275,55 @@ typedef int32_t (*lehmer_generate_t)(int32_t);
  */
 lehmer_state_t* lehmer_state_create(int32_t seed, uint32_t length);
 
+/**
+ * @brief Create a lean single-seed Lehmer RNG state.
+ *
+ * The lean mode holds just the current seed inline: no heap sequence is
+ * allocated and no eager generation is performed. Intended for workloads
+ * that create many short-lived states and draw values one at a time via
+ * lehmer_random_lean().
+ *
+ * @param seed The initial seed value.
+ *
+ * @return A newly allocated lean state object or NULL if memory allocation
+ * fails.
+ */
+lehmer_state_t* lehmer_state_create_lean(int32_t seed);
+
+/**
+ * @brief Initialize a caller-owned Lehmer RNG state without allocating.
+ *
+ * The state struct and the sequence buffer both belong to the caller (e.g.
+ * stack variables or a slice of an arena), so no heap allocation occurs and
+ * no teardown is required. The sequence is eagerly generated, matching
+ * lehmer_state_create().
+ *
+ * @param state The caller-owned state object to initialize.
+ * @param sequence The caller-owned sequence buffer, or NULL to initialize
+ * the state in the lean single-seed mode.
+ * @param length The number of values the sequence buffer holds.
+ * @param seed The initial seed value.
+ */
+void lehmer_state_init(
+    lehmer_state_t* state, int32_t* sequence, uint32_t length, int32_t seed
+);
+
+/**
+ * @brief Create a Lehmer RNG state with lazy sequence generation.
+ *
+ * Construction allocates the sequence but generates nothing: the seed
+ * getters extend the materialized prefix incrementally as the position
+ * crosses the high-water mark. Jobs that touch a fraction of a large
+ * sequence pay only for that fraction.
+ *
+ * @param seed The initial seed value.
+ * @param length The number of values to generate (upper limit).
+ *
+ * @return A newly allocated lazy Lehmer RNG state object or NULL if memory
+ * allocation fails.
+ */
+lehmer_state_t* lehmer_state_create_lazy(int32_t seed, uint32_t length);
+
 /**
  * @brief Free the allocated memory for the Lehmer RNG state object.
  *
@@ -255,6 +419,19 @@ int32_t lehmer_set_next_and_get_seed(lehmer_state_t* state);
  */
 float lehmer_seed_normalize_to_float(int32_t seed);
 
+/**
+ * @brief Normalizes a seed to a double in the range 0.0 to 1.0
+ *
+ * Unlike the float path, the double mantissa preserves all 31 bits of the
+ * seed, and the normalization multiplies by a precomputed 1/m constant
+ * instead of dividing.
+ *
+ * @param seed The seed to normalize.
+ *
+ * @return The normalized seed as a double in the range 0.0 to 1.0
+ */
+double lehmer_seed_normalize_to_double(int32_t seed);
+
 /**
  * @brief Normalizes a seed to an integer in the range 0 to m - 1
  *
@@ -333,6 +510,19 @@ int32_t lehmer_generate_delta(int32_t seed);
  */
 int32_t lehmer_generate_jump(int32_t seed);
 
+/**
+ * @brief The binding function for the Lehmer LCG PRNG.
+ *
+ * Combines the gamma and delta terms:
+ *
+ * \f(z) = \gamma(z) + m \cdot \delta(z)
+ *
+ * @param[in] seed An integer representing the current seed.
+ *
+ * @return An integer representing the next seed in the sequence.
+ */
+int32_t lehmer_generate_binder(int32_t seed);
+
 // Generalized Lehmer sequence generator
 
 /**
@@ -371,6 +561,40 @@ void lehmer_generate_time(lehmer_state_t* state, lehmer_generate_t generator);
  */
 void lehmer_regenerate(lehmer_state_t* state, lehmer_generate_t generator);
 
+/**
+ * @brief Advance the state by k steps of the modulo recurrence.
+ *
+ * k applications of f(z) = az mod m collapse into a single multiplication
+ * by a^k mod m, served from precomputed power tables: jumps up to 256 are
+ * one lookup, anything else costs at most popcount(k) table multiplies.
+ * This allows one logical stream to be partitioned into disjoint
+ * sub-streams (e.g. one per worker thread) without generating and
+ * discarding k values, and makes dynamic work redistribution cheap enough
+ * to issue millions of times per run.
+ *
+ * The jumped seed becomes the new root seed and the sequence is
+ * regenerated from it.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param k The number of steps to jump ahead.
+ */
+void lehmer_state_jump(lehmer_state_t* state, uint64_t k);
+
+/**
+ * @brief Computes the i-th seed of a stream without any state.
+ *
+ * Stateless sibling of lehmer_state_jump(): collapses i steps of the
+ * modulo recurrence into a single multiplier (a^i mod m) served from the
+ * shared power tables, so parallel workers can generate element i for
+ * index i in any order with no shared state and no fast-forwarding.
+ *
+ * @param seed The initial seed of the stream
+ * @param i The zero-based step index; i == 0 returns the seed itself
+ *
+ * @return The seed the stream would hold after i steps
+ */
+int32_t lehmer_at(int32_t seed, uint64_t i);
+
 // Lehmer random number generators
 
 /**
@@ -385,6 +609,18 @@ float lehmer_random_gamma(lehmer_state_t* state);
 float lehmer_random_jump(lehmer_state_t* state);
 float lehmer_random_delta(lehmer_state_t* state);
 
+/**
+ * @brief Generate a random number from a lean single-seed state.
+ *
+ * Advances the stream in place using the modulo approach, with no
+ * pregenerated sequence and no position bookkeeping.
+ *
+ * @param state A lean state created via lehmer_state_create_lean().
+ *
+ * @return Random float between 0 and 1.
+ */
+float lehmer_random_lean(lehmer_state_t* state);
+
 /**
  * @brief Generate a random number using a custom generator.
  *
@@ -396,6 +632,491 @@ float lehmer_random_delta(lehmer_state_t* state);
  */
 float lehmer_random(lehmer_state_t* state, lehmer_generate_t generator);
 
+// Lehmer bounded integer generators
+
+/**
+ * @brief Generate a uniform random integer in the range 0 to range - 1.
+ *
+ * Uses Lemire's multiply-shift rejection method on the 31-bit seed: one
+ * 64-bit multiply and a shift in the common case, with the division needed
+ * for the rejection threshold only taken on the rare reject path. Unlike
+ * `seed % range`, the result carries no modulo bias.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param range The exclusive upper bound (must be greater than 0).
+ *
+ * @return Random integer in the range 0 to range - 1.
+ */
+uint32_t lehmer_random_bounded(lehmer_state_t* state, uint32_t range);
+
+/**
+ * @brief Fill a caller-provided buffer with bounded integers in one call.
+ *
+ * Batch sibling of lehmer_random_bounded().
+ *
+ * @param state The Lehmer RNG state object.
+ * @param range The exclusive upper bound (must be greater than 0).
+ * @param buffer The caller-provided output buffer.
+ * @param size The number of integers to generate.
+ */
+void lehmer_random_bounded_fill(
+    lehmer_state_t* state, uint32_t range, uint32_t* buffer, size_t size
+);
+
+// Lehmer shuffling and sampling
+
+/**
+ * @brief Shuffle an array in place with an unbiased Fisher-Yates pass.
+ *
+ * Indices are drawn directly in integer space with the same rejection
+ * scheme as lehmer_random_bounded(), so large arrays see no float
+ * round-trip and no modulo bias. Advances the stream in place.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param base The array to shuffle.
+ * @param n The number of elements (must be below 2^31).
+ * @param elem_size The size of each element in bytes.
+ */
+void lehmer_shuffle(
+    lehmer_state_t* state, void* base, size_t n, size_t elem_size
+);
+
+/**
+ * @brief Sample k distinct indices from 0, ..., n - 1 without replacement.
+ *
+ * Selection sampling (Knuth's Algorithm S): one sequential pass keeps
+ * index i with probability (k - chosen) / (n - i), emitting the sample
+ * in increasing order. Advances the stream in place.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param n The population size (must be below 2^31).
+ * @param k The sample size (must not exceed n).
+ * @param out A caller-provided buffer of k indices.
+ */
+void lehmer_sample_k(
+    lehmer_state_t* state, uint32_t n, uint32_t k, uint32_t* out
+);
+
+// Lehmer double-precision random number generators
+
+/**
+ * @brief Double-precision variants of the random number generators.
+ *
+ * Each is the exact analogue of its float sibling, normalized via
+ * lehmer_seed_normalize_to_double() so numerically sensitive consumers
+ * keep all 31 bits of the seed in a single draw.
+ *
+ * @param state Pointer to the Lehmer state structure.
+ *
+ * @return Random double between 0 and 1.
+ */
+double lehmer_random_modulo_d(lehmer_state_t* state);
+double lehmer_random_gamma_d(lehmer_state_t* state);
+double lehmer_random_jump_d(lehmer_state_t* state);
+double lehmer_random_delta_d(lehmer_state_t* state);
+
+/**
+ * @brief Generate a double-precision random number using a custom generator.
+ *
+ * @param state Pointer to the Lehmer state structure.
+ * @param generator Function pointer to the generator method (e.g., modulo,
+ * gamma).
+ *
+ * @return Random double between 0 and 1.
+ */
+double lehmer_random_d(lehmer_state_t* state, lehmer_generate_t generator);
+
+// Lehmer bulk generation
+
+/**
+ * @brief Fill a caller-provided buffer with raw seeds in a single call.
+ *
+ * The recurrence is advanced in a local variable, so the per-draw position
+ * bookkeeping is skipped entirely. The final seed is written back into the
+ * current sequence slot, allowing per-call draws to continue the stream.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param buffer The caller-provided output buffer.
+ * @param size The number of seeds to generate.
+ */
+void lehmer_seed_fill(lehmer_state_t* state, int32_t* buffer, size_t size);
+
+/**
+ * @brief Fill a caller-provided buffer with normalized floats in a single
+ * call.
+ *
+ * Batch sibling of lehmer_random_modulo() for hot loops. Each value is a
+ * float in the range 0.0 to 1.0.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param buffer The caller-provided output buffer.
+ * @param size The number of values to generate.
+ */
+void lehmer_random_fill(lehmer_state_t* state, float* buffer, size_t size);
+
+/**
+ * @brief Fill a caller-provided buffer with normalized doubles in a single
+ * call.
+ *
+ * Double-precision sibling of lehmer_random_fill().
+ *
+ * @param state The Lehmer RNG state object.
+ * @param buffer The caller-provided output buffer.
+ * @param size The number of values to generate.
+ */
+void lehmer_random_fill_d(lehmer_state_t* state, double* buffer, size_t size);
+
+// Lehmer stream output
+
+/**
+ * @param LEHMER_STREAM_BUFFER Bytes per ping-pong buffer (256 KiB).
+ */
+#define LEHMER_STREAM_BUFFER (1U << 18)
+
+/**
+ * @brief Stream raw float variates to a file descriptor.
+ *
+ * Generates into two ping-pong buffers and overlaps generation with
+ * asynchronous writes (POSIX aio), so one core can keep the descriptor
+ * saturated instead of stalling while the kernel copies each batch.
+ * n_bytes is rounded down to a whole number of floats. Advances the
+ * stream in place.
+ *
+ * @param state The Lehmer RNG state object.
+ * @param generator The generation function (e.g. lehmer_generate_modulo).
+ * @param fd The destination file descriptor.
+ * @param n_bytes The number of bytes of variates to write.
+ *
+ * @return true if every byte was written, false otherwise.
+ */
+bool lehmer_stream_to_fd(
+    lehmer_state_t* state, lehmer_generate_t generator, int fd, size_t n_bytes
+);
+
+// Lehmer state persistence
+
+/**
+ * @param LEHMER_SNAPSHOT_MAGIC Identifies a Lehmer snapshot ("LEHM").
+ */
+#define LEHMER_SNAPSHOT_MAGIC 0x4D48454CU
+
+/**
+ * @param LEHMER_SNAPSHOT_VERSION Version of the snapshot layout.
+ */
+#define LEHMER_SNAPSHOT_VERSION 1
+
+/**
+ * @brief Fixed on-disk layout for a persisted Lehmer state.
+ *
+ * The header is immediately followed by `length` int32_t sequence values,
+ * so a saved snapshot can be memory-mapped and used in place with zero
+ * deserialization.
+ *
+ * @param magic Identifies the file as a Lehmer snapshot.
+ * @param version The snapshot layout version.
+ * @param seed The initial seed used to start the sequence.
+ * @param length The number of values in the sequence.
+ * @param position The current position in the sequence.
+ * @param reserved Padding; keeps the sequence 8-byte aligned.
+ */
+typedef struct LehmerSnapshotHeader {
+    uint32_t magic; // Identifies the file as a Lehmer snapshot
+    uint32_t version; // The snapshot layout version
+    int32_t seed; // The initial seed used to start the sequence
+    uint32_t length; // The number of values in the sequence
+    uint32_t position; // The current position in the sequence
+    uint32_t reserved; // Padding; keeps the sequence 8-byte aligned
+} lehmer_snapshot_header_t;
+
+/**
+ * @brief Write a state to a file descriptor in the snapshot format.
+ *
+ * @param state The Lehmer RNG state object to persist.
+ * @param fd An open file descriptor positioned where the snapshot goes.
+ *
+ * @return true on success, false on a short or failed write.
+ */
+bool lehmer_state_save(lehmer_state_t* state, int fd);
+
+/**
+ * @brief Initialize a caller-owned state from a mapped snapshot, in place.
+ *
+ * The sequence pointer aims directly into the mapping (addr + header), so
+ * no copy occurs. The caller owns both the state struct and the mapping:
+ * unmap the region instead of calling lehmer_state_free(), and map with
+ * write access (or MAP_PRIVATE) if the state will be advanced.
+ *
+ * @param state The caller-owned state object to initialize.
+ * @param addr The address of a memory-mapped snapshot.
+ *
+ * @return true on success, false if the header fails validation.
+ */
+bool lehmer_state_map(lehmer_state_t* state, void* addr);
+
+// Lehmer parallel stream management
+
+/**
+ * @param LEHMER_STRIDE Default sub-stream length for stream pools (2^24).
+ *
+ * Each stream in a pool starts this many steps after the previous one, so
+ * streams remain disjoint as long as no stream draws more than
+ * LEHMER_STRIDE values.
+ */
+#define LEHMER_STRIDE 16777216ULL
+
+/**
+ * @brief Structure representing a pool of disjoint Lehmer streams.
+ *
+ * The pool partitions one logical stream into disjoint sub-streams via
+ * jump-ahead, one state per worker thread. Thread safety comes from
+ * sharing nothing: each worker draws exclusively from its own state and no
+ * locks are required.
+ *
+ * @param streams One state per stream; never shared between workers.
+ * @param count The number of streams in the pool.
+ */
+typedef struct LehmerStreamPool {
+    lehmer_state_t** streams; // One state per stream; never shared
+    uint32_t count; // The number of streams in the pool
+} lehmer_stream_pool_t;
+
+/**
+ * @brief Create a pool of disjoint streams from one logical stream.
+ *
+ * Stream i is jumped ahead by i * stride steps, so workers can draw
+ * concurrently without correlation or coordination.
+ *
+ * @param count The number of streams (e.g. one per worker thread).
+ * @param seed The initial seed for the logical stream.
+ * @param length The sequence length for each state.
+ * @param stride The sub-stream length, or 0 for LEHMER_STRIDE.
+ *
+ * @return A newly allocated pool or NULL if memory allocation fails.
+ */
+lehmer_stream_pool_t* lehmer_stream_pool_create(
+    uint32_t count, int32_t seed, uint32_t length, uint64_t stride
+);
+
+/**
+ * @brief Get the state for a given stream index.
+ *
+ * @param pool The stream pool.
+ * @param index The stream index (e.g. the worker thread id).
+ *
+ * @return The state owned by that stream, or NULL if index is out of range.
+ */
+lehmer_state_t* lehmer_stream_pool_get(
+    lehmer_stream_pool_t* pool, uint32_t index
+);
+
+/**
+ * @brief Free the pool and every state it owns.
+ *
+ * @param pool The stream pool to be freed.
+ */
+void lehmer_stream_pool_free(lehmer_stream_pool_t* pool);
+
+/**
+ * @param LEHMER_BANK_ALIGNMENT Cache-line alignment for bank seed storage.
+ */
+#define LEHMER_BANK_ALIGNMENT 64
+
+/**
+ * @brief Structure representing a bank of interleaved generators.
+ *
+ * Structure-of-arrays sibling of lehmer_stream_pool_t for the
+ * many-generators case: all current seeds live in one contiguous,
+ * cache-line-aligned array with no per-state sequence buffers, so
+ * stepping every lane is a streaming read instead of a pointer chase
+ * per generator. The lanes are independent, which lets the step loop
+ * vectorize.
+ */
+typedef struct LehmerBank {
+    int32_t* seeds; // Current seed per lane; 64-byte aligned
+    uint32_t count; // The number of lanes in the bank
+} lehmer_bank_t;
+
+/**
+ * @brief Create a bank of independent generator lanes.
+ *
+ * Lane i starts i * LEHMER_STRIDE steps into the logical stream, so
+ * lanes remain disjoint as long as no lane draws more than
+ * LEHMER_STRIDE values.
+ *
+ * @param seed The initial seed for the logical stream.
+ * @param count The number of lanes (e.g. one per simulated agent).
+ *
+ * @return A newly allocated bank or NULL if memory allocation fails.
+ */
+lehmer_bank_t* lehmer_bank_create(int32_t seed, uint32_t count);
+
+/**
+ * @brief Advance every lane one step and optionally emit the draws.
+ *
+ * @param bank The bank of generator lanes.
+ * @param out A caller-provided buffer of bank->count floats, or NULL to
+ * advance the lanes without emitting values.
+ */
+void lehmer_bank_step_all(lehmer_bank_t* bank, float* out);
+
+/**
+ * @brief Free the bank and its seed storage.
+ *
+ * @param bank The bank to be freed.
+ */
+void lehmer_bank_free(lehmer_bank_t* bank);
+
+/**
+ * @brief Replay record for one stream: everything needed to revisit it.
+ *
+ * A worker's entire draw history collapses to 16 bytes because the
+ * recurrence is a pure function of the seed: stream i begins
+ * i * LEHMER_STRIDE steps into the logical stream (the pool and bank
+ * layout), and draw n of that stream is lehmer_at() of its start. The
+ * forward path only pays one counter increment per draw; no values are
+ * stored.
+ *
+ * @param seed The initial seed of the logical stream.
+ * @param stream The stream index (e.g. the worker thread id).
+ * @param draws The number of draws the stream has consumed.
+ */
+typedef struct LehmerRecord {
+    int32_t seed; // The initial seed of the logical stream
+    uint32_t stream; // The stream index
+    uint64_t draws; // The number of draws consumed so far
+} lehmer_record_t;
+
+/**
+ * @brief Initialize a replay record for one stream.
+ *
+ * Call once when the worker's stream is created, then increment
+ * record->draws alongside every draw (or add the batch size after a
+ * fill). That counter is the entire forward-path cost.
+ *
+ * @param record The record to initialize.
+ * @param seed The initial seed of the logical stream.
+ * @param stream The stream index.
+ */
+void lehmer_record_init(
+    lehmer_record_t* record, int32_t seed, uint32_t stream
+);
+
+/**
+ * @brief Reconstruct the seed a stream held at an arbitrary draw index.
+ *
+ * Jumps the record's stream to draw index i without replaying the
+ * draws in between: O(log i) multiplies via the jump-ahead tables.
+ * Index 0 is the stream's initial seed; index n is the value the n-th
+ * call to lehmer_set_next_and_get_seed() returned.
+ *
+ * @param record The record describing the stream.
+ * @param i The draw index to reconstruct.
+ *
+ * @return The seed the stream held at draw i.
+ */
+int32_t lehmer_replay_seek(const lehmer_record_t* record, uint64_t i);
+
+/**
+ * @brief Reconstruct a stream exactly where its worker left off.
+ *
+ * Equivalent to lehmer_replay_seek(record, record->draws): the
+ * returned seed continues the stream as if the original worker had
+ * never stopped.
+ *
+ * @param record The record describing the stream.
+ *
+ * @return The seed the stream held after its recorded draws.
+ */
+int32_t lehmer_replay_open(const lehmer_record_t* record);
+
+// 64-bit Lehmer engine
+
+/**
+ * @param LEHMER64_MODULUS Mersenne prime number used as modulus (2^61 - 1).
+ *
+ * The 64-bit analogue of LEHMER_MODULUS, giving a period of 2^61 - 2
+ * instead of 2^31 - 2. Intermediate products require a 128-bit multiply.
+ */
+#define LEHMER64_MODULUS 2305843009213693951ULL
+
+/**
+ * @param LEHMER64_MULTIPLIER Multiplier for the 64-bit engine.
+ *
+ * a: A full-period multiplier in the range 2, ..., m - 1
+ *
+ * @ref Tables of linear congruential generators of different sizes and good
+ * lattice structure (L'Ecuyer, 1999) for m = 2^61 - 1.
+ */
+#define LEHMER64_MULTIPLIER 437799614237992725ULL
+
+/**
+ * @param LEHMER64_SEED Default seed value for the 64-bit engine.
+ *
+ * z: A integer value in the range 1, ..., m - 1
+ */
+#define LEHMER64_SEED 123456789ULL
+
+/**
+ * @brief Structure representing the state of the 64-bit Lehmer engine.
+ *
+ * The 64-bit engine keeps just the current seed; it advances in place
+ * rather than walking a pregenerated sequence.
+ *
+ * @param seed The current seed in the stream.
+ */
+typedef struct Lehmer64State {
+    uint64_t seed; // The current seed in the stream
+} lehmer64_state_t;
+
+/**
+ * @brief Create and initialize a 64-bit Lehmer engine state.
+ *
+ * @param seed The initial seed value.
+ *
+ * @return A newly allocated and initialized state object or NULL if memory
+ * allocation fails.
+ */
+lehmer64_state_t* lehmer64_state_create(uint64_t seed);
+
+/**
+ * @brief Free the allocated memory for the 64-bit engine state object.
+ *
+ * @param state The state object to be freed.
+ */
+void lehmer64_state_free(lehmer64_state_t* state);
+
+/**
+ * @brief The 64-bit analogue of lehmer_generate_modulo.
+ *
+ * z_{n+1} = a \cdot z_n \mod m with m = 2^61 - 1, computed with a 128-bit
+ * intermediate multiply.
+ *
+ * @param[in] seed An integer representing the current seed.
+ *
+ * @return An integer representing the next seed in the sequence.
+ */
+uint64_t lehmer64_generate_modulo(uint64_t seed);
+
+/**
+ * @brief Normalizes a seed to a double in the range 0.0 to 1.0
+ *
+ * @param seed The seed to normalize.
+ *
+ * @return The normalized seed as a double in the range 0.0 to 1.0
+ */
+double lehmer64_seed_normalize_to_double(uint64_t seed);
+
+/**
+ * @brief Generate a random number using the 64-bit engine.
+ *
+ * Advances the state in place and normalizes the new seed.
+ *
+ * @param state Pointer to the 64-bit engine state structure.
+ *
+ * @return Random double between 0 and 1.
+ */
+double lehmer64_random(lehmer64_state_t* state);
+
 // Lehmer probability functions
 
 /**
@@ -438,4 +1159,83 @@ int32_t lehmer_bernoulli(lehmer_state_t* state, float p);
  */
 int32_t lehmer_binomial(lehmer_state_t* state, uint32_t n, float p);
 
+/**
+ * @brief Generates a standard normal (Gaussian) random variable.
+ *
+ * Implemented with the Ziggurat method over precomputed static tables: the
+ * common path is one draw, one table lookup, and one compare, with the
+ * wedge and tail handled by rejection. Advances the stream in place.
+ *
+ * @param state The Lehmer RNG state object
+ *
+ * @return A normally distributed double with mean 0 and variance 1
+ */
+double lehmer_normal(lehmer_state_t* state);
+
+/**
+ * @brief Generates an exponential random variable with rate 1.
+ *
+ * Ziggurat sibling of lehmer_normal(). Scale by 1/lambda for other rates.
+ * Advances the stream in place.
+ *
+ * @param state The Lehmer RNG state object
+ *
+ * @return An exponentially distributed double with mean 1
+ */
+double lehmer_exponential(lehmer_state_t* state);
+
+/**
+ * @brief Fill a caller-provided buffer with standard normal variates.
+ *
+ * Batch sibling of lehmer_normal().
+ *
+ * @param state The Lehmer RNG state object
+ * @param buffer The caller-provided output buffer
+ * @param size The number of variates to generate
+ */
+void lehmer_normal_fill(lehmer_state_t* state, double* buffer, size_t size);
+
+/**
+ * @brief Fill a caller-provided buffer with exponential variates.
+ *
+ * Batch sibling of lehmer_exponential().
+ *
+ * @param state The Lehmer RNG state object
+ * @param buffer The caller-provided output buffer
+ * @param size The number of variates to generate
+ */
+void lehmer_exponential_fill(
+    lehmer_state_t* state, double* buffer, size_t size
+);
+
+/**
+ * @brief Fill a caller-provided buffer with Bernoulli outcomes in one call.
+ *
+ * Batch sibling of lehmer_bernoulli(): the recurrence is advanced in a
+ * local variable, skipping the per-draw position bookkeeping.
+ *
+ * @param state The Lehmer RNG state object
+ * @param p The probability of generating a 1 (0 < p < 1)
+ * @param buffer The caller-provided output buffer
+ * @param size The number of outcomes to generate
+ */
+void lehmer_bernoulli_fill(
+    lehmer_state_t* state, float p, int32_t* buffer, size_t size
+);
+
+/**
+ * @brief Fill a caller-provided buffer with Binomial variates in one call.
+ *
+ * Batch sibling of lehmer_binomial().
+ *
+ * @param state The Lehmer RNG state object
+ * @param n The number of trials
+ * @param p The probability of success in each trial (0 < p < 1)
+ * @param buffer The caller-provided output buffer
+ * @param size The number of variates to generate
+ */
+void lehmer_binomial_fill(
+    lehmer_state_t* state, uint32_t n, float p, int32_t* buffer, size_t size
+);
+
 #endif // LEHMER_H
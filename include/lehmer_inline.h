@@ -0,0 +1,58 @@
+/**
+ * Copyright © 2024 Austin Berrio
+ *
+ * @file include/lehmer_inline.h
+ *
+ * @brief Header-only fast path for the core recurrence.
+ *
+ * The shared library makes every lehmer_generate_modulo() call a PLT
+ * indirection, which dominates the tightest loops. Everything here is
+ * static inline over compile-time constants, so including this header
+ * compiles the advance-and-return operation down to a multiply, a
+ * reduction, and a store — no call, no library boundary. The existing
+ * ABI in lehmer.h is untouched for everyone else.
+ *
+ * Callers own the seed: seed it once (e.g. with LEHMER_SEED or
+ * lehmer_get_current_seed()) and pass its address to every draw.
+ */
+
+#ifndef LEHMER_INLINE_H
+#define LEHMER_INLINE_H
+
+#include "lehmer.h"
+
+/**
+ * @brief Advance the seed one recurrence step and return it.
+ *
+ * @param seed The caller-owned seed; advanced in place.
+ *
+ * @return The new seed in the range 1 to m - 1.
+ */
+static inline int32_t lehmer_next(int32_t* seed) {
+    *seed = lehmer_inline_modulo(*seed);
+    return *seed;
+}
+
+/**
+ * @brief Advance the seed one step and normalize to a float in 0.0 to 1.0.
+ *
+ * @param seed The caller-owned seed; advanced in place.
+ *
+ * @return A uniformly distributed float.
+ */
+static inline float lehmer_next_float(int32_t* seed) {
+    return (float) lehmer_next(seed) / (float) LEHMER_MODULUS;
+}
+
+/**
+ * @brief Advance the seed one step and normalize to a double in 0.0 to 1.0.
+ *
+ * @param seed The caller-owned seed; advanced in place.
+ *
+ * @return A uniformly distributed double with the full 31 bits of the seed.
+ */
+static inline double lehmer_next_double(int32_t* seed) {
+    return (double) lehmer_next(seed) / (double) LEHMER_MODULUS;
+}
+
+#endif // LEHMER_INLINE_H
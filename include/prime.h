@@ -43,6 +43,47 @@ typedef struct PrimeSample {
  */
 int32_t prime_modular_exponent(int32_t a, int32_t b, uint32_t m);
 
+/**
+ * @brief Precomputed Montgomery context for a fixed odd modulus
+ *
+ * Montgomery form replaces the two hardware divisions per exponent bit in
+ * plain modular exponentiation with multiply-and-shift reductions. The
+ * context is computed once per modulus and reused across exponentiations,
+ * which is the shape of a multiplier-search workload.
+ *
+ * @param modulus The modulus m (must be odd for Montgomery reduction)
+ * @param inverse -m^-1 mod 2^32, used by the reduction step
+ * @param r2 R^2 mod m with R = 2^32, used to enter Montgomery form
+ */
+typedef struct PrimeModExpContext {
+    uint32_t modulus; // The modulus m (must be odd)
+    uint32_t inverse; // -m^-1 mod 2^32
+    uint32_t r2; // R^2 mod m with R = 2^32
+} prime_modexp_ctx_t;
+
+/**
+ * @brief Initialize a Montgomery context for a fixed modulus
+ *
+ * @param ctx The context to initialize
+ * @param m The modulus (m > 1)
+ * @return true on success, false if m is even (Montgomery requires odd m)
+ */
+bool prime_modexp_ctx_init(prime_modexp_ctx_t* ctx, uint32_t m);
+
+/**
+ * @brief Computes a^b mod m using the precomputed Montgomery context
+ *
+ * Division-free exponentiation: every reduction is a multiply and a
+ * shift. Produces the same result as prime_modular_exponent() for odd m,
+ * without overflow for any 32-bit modulus.
+ *
+ * @param ctx A context initialized via prime_modexp_ctx_init()
+ * @param a Base integer
+ * @param b Exponent
+ * @return Computed result of a^b mod m
+ */
+uint32_t prime_modexp(const prime_modexp_ctx_t* ctx, uint32_t a, uint32_t b);
+
 /**
  * @brief Determine whether a given number is likely prime or not
  *
@@ -68,6 +109,34 @@ int32_t prime_modular_exponent(int32_t a, int32_t b, uint32_t m);
  */
 bool prime_miller_rabin(lehmer_state_t* state, uint32_t n, uint16_t k);
 
+/**
+ * @brief Deterministically decide primality for any 32-bit integer
+ *
+ * Runs Miller-Rabin with the fixed witness set {2, 7, 61}, which is proven
+ * exact for every n below 4,759,123,141 — the whole 32-bit range. No RNG
+ * draws are needed and the squaring is done in 64-bit, so large moduli do
+ * not overflow.
+ *
+ * @param n Integer to be tested for primality
+ * @return true if n is prime, otherwise false.
+ */
+bool prime_miller_rabin_deterministic(uint32_t n);
+
+/**
+ * @brief Test a batch of candidates for primality in one call
+ *
+ * Applies the deterministic witness fast path to each candidate, writing 1
+ * for prime and 0 for composite. Intended for multiplier-search workloads
+ * that screen millions of candidates.
+ *
+ * @param candidates The candidate integers to test
+ * @param size The number of candidates
+ * @param out Caller-provided output buffer, one byte per candidate
+ */
+void prime_miller_rabin_batch(
+    const uint32_t* candidates, size_t size, uint8_t* out
+);
+
 /**
  * @brief Create an array of prime numbers as sample data.
  *
@@ -85,4 +154,73 @@ prime_sample_t* prime_sample_create(uint32_t size);
  */
 void prime_sample_free(prime_sample_t* samples);
 
+/**
+ * @brief Candidates per segment for the segmented sieve iterator
+ *
+ * 1 << 18 candidates is a 32 KiB bitset, small enough to stay resident in
+ * L2 while the base primes stride across it.
+ */
+#define PRIME_ITER_SEGMENT (1U << 18)
+
+/**
+ * @brief Segmented sieve iterator over [2, limit]
+ *
+ * prime_sample_create() materializes every prime up to the limit in one
+ * heap array, which for huge ranges means gigabytes resident and a long
+ * warm-up before the first candidate is available. The iterator sieves
+ * one PRIME_ITER_SEGMENT-wide window at a time against a base table of
+ * primes up to sqrt(limit), so memory stays O(segment) and the first
+ * batch arrives after a single small sieve pass.
+ *
+ * @param low The start of the next unsieved segment
+ * @param limit The inclusive upper bound of the iteration
+ * @param base The base primes up to sqrt(limit), sieved once at creation
+ * @param base_count The number of base primes
+ * @param composite The segment bitset, reused for every segment
+ * @param batch The primes found in the current segment
+ */
+typedef struct PrimeIter {
+    uint64_t low; // The start of the next unsieved segment
+    uint32_t limit; // The inclusive upper bound of the iteration
+    int32_t* base; // The base primes up to sqrt(limit)
+    uint32_t base_count; // The number of base primes
+    uint32_t* composite; // The segment bitset, reused for every segment
+    int32_t* batch; // The primes found in the current segment
+} prime_iter_t;
+
+/**
+ * @brief Create a segmented sieve iterator over [2, limit]
+ *
+ * Sieves the base primes up to sqrt(limit) and allocates the reusable
+ * segment buffers. No segment is sieved until the first call to
+ * prime_iter_next_segment().
+ *
+ * @param limit Inclusive upper bound of the iteration (must be > 1)
+ * @return Pointer to a dynamically allocated prime_iter_t structure.
+ */
+prime_iter_t* prime_iter_create(uint32_t limit);
+
+/**
+ * @brief Sieve the next segment and hand out its batch of primes
+ *
+ * The returned batch lives in the iterator and is overwritten by the
+ * next call; copy out any primes that must outlive it.
+ *
+ * @param iter The iterator to advance
+ * @param out Receives a pointer to the batch of primes in this segment
+ * @param count Receives the number of primes in the batch
+ * @return true if a segment was produced, false when the range is
+ * exhausted (out is set to NULL and count to 0).
+ */
+bool prime_iter_next_segment(
+    prime_iter_t* iter, int32_t** out, uint32_t* count
+);
+
+/**
+ * @brief Free the iterator and its buffers.
+ *
+ * @param iter Pointer to the prime_iter_t structure.
+ */
+void prime_iter_free(prime_iter_t* iter);
+
 #endif // PRIME_H
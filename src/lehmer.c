@@ -26,12 +26,79 @@
 #include "lehmer.h"
 #include "logger.h"
 
+#include <aio.h>
+#include <errno.h>
 #include <math.h>
 #include <stdio.h>
 #include <time.h>
+#include <unistd.h>
+
+// Lehmer instrumentation (opt-in via -DLEHMER_ENABLE_STATS)
+
+#ifdef LEHMER_ENABLE_STATS
+// Runtime master switch; counting defaults to on when compiled in
+static bool lehmer_stats_enabled = true;
+
+#define LEHMER_STATS_ADD(state, field, n) \
+    do { \
+        if (lehmer_stats_enabled) { \
+            (state)->stats.field += (n); \
+        } \
+    } while (0)
+
+#define LEHMER_STATS_RESET(state) \
+    do { \
+        (state)->stats = (lehmer_stats_t) {0}; \
+    } while (0)
+#else
+// The disabled macros expand to nothing: zero overhead, zero branches
+#define LEHMER_STATS_ADD(state, field, n) ((void) 0)
+#define LEHMER_STATS_RESET(state) ((void) 0)
+#endif // LEHMER_ENABLE_STATS
+
+// Lehmer cache control (see LEHMER_CACHE_BUDGET)
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif // __SSE2__
+
+#if defined(__GNUC__)
+// Hint the cache to pull an address the caller will touch shortly
+#define LEHMER_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define LEHMER_PREFETCH(address) ((void) 0)
+#endif // __GNUC__
+
+// True when the sequence storage cannot stay resident under the budget
+static inline bool lehmer_sequence_exceeds_budget(uint32_t length) {
+    return (uint64_t) length * sizeof(int32_t) > LEHMER_CACHE_BUDGET;
+}
+
+// Write a sequence element without claiming its cache line; falls back to
+// a plain store on targets without non-temporal integer stores
+static inline void lehmer_sequence_stream(int32_t* address, int32_t value) {
+#if defined(__SSE2__)
+    _mm_stream_si32((int*) address, value);
+#else
+    *address = value;
+#endif
+}
+
+// Drain the write-combining buffers after a streamed refill so the new
+// sequence is globally visible before any other thread reads it
+static inline void lehmer_sequence_stream_fence(void) {
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
 
 // Lehmer state management
 
+// Cursor mask for power-of-two lengths; 0 selects the modulo fallback
+static inline uint32_t lehmer_position_mask(uint32_t length) {
+    return (0 == (length & (length - 1))) ? length - 1 : 0;
+}
+
 // Create and initialize the state with dynamic seed generation
 lehmer_state_t* lehmer_state_create(int32_t seed, uint32_t length) {
     // Allocate memory for managing the LCG PRNG state
@@ -47,6 +114,8 @@ lehmer_state_t* lehmer_state_create(int32_t seed, uint32_t length) {
     state->seed = (0 >= seed) ? LEHMER_SEED : seed % LEHMER_MODULUS;
     // Default to a size of 256 if size is 0
     state->length = (0 >= length) ? LEHMER_SIZE : length % UINT32_MAX;
+    // Power-of-two lengths turn every cursor update into a single AND
+    state->mask = lehmer_position_mask(state->length);
 
     // Allocate memory for generating seeds
     state->sequence = (int32_t*) malloc(sizeof(int32_t) * state->length);
@@ -61,14 +130,107 @@ lehmer_state_t* lehmer_state_create(int32_t seed, uint32_t length) {
 
     // Initialize the state object
     lehmer_generate(state, lehmer_generate_modulo, seed);
+    LEHMER_STATS_RESET(state);
+
+    return state;
+}
+
+// Create a lean single-seed state with no heap sequence
+lehmer_state_t* lehmer_state_create_lean(int32_t seed) {
+    // Allocate memory for managing the LCG PRNG state
+    lehmer_state_t* state = (lehmer_state_t*) malloc(sizeof(lehmer_state_t));
+    if (NULL == state) {
+        LOG_ERROR("Failed to allocate memory to lehmer state.\n");
+        return NULL;
+    }
+
+    // Zero-initialize the index
+    state->position = 0;
+    // Default to a seed of 123456789 if seed is 0
+    state->seed = (0 >= seed) ? LEHMER_SEED : seed % LEHMER_MODULUS;
+    // A lean state is a sequence of exactly one seed
+    state->length = 1;
+    state->mask = lehmer_position_mask(state->length);
+
+    // Point the sequence at the inline slot; no heap, no eager generation
+    state->sequence = &state->scalar;
+    state->sequence[0] = state->seed;
+    state->filled = 1;
+    LEHMER_STATS_RESET(state);
+
+    return state;
+}
+
+// Create a state with lazy sequence generation
+lehmer_state_t* lehmer_state_create_lazy(int32_t seed, uint32_t length) {
+    // Allocate memory for managing the LCG PRNG state
+    lehmer_state_t* state = (lehmer_state_t*) malloc(sizeof(lehmer_state_t));
+    if (NULL == state) {
+        LOG_ERROR("Failed to allocate memory to lehmer state.\n");
+        return NULL;
+    }
+
+    // Zero-initialize the index
+    state->position = 0;
+    // Default to a seed of 123456789 if seed is 0
+    state->seed = (0 >= seed) ? LEHMER_SEED : seed % LEHMER_MODULUS;
+    // Default to a size of 256 if size is 0
+    state->length = (0 >= length) ? LEHMER_SIZE : length % UINT32_MAX;
+    // Power-of-two lengths turn every cursor update into a single AND
+    state->mask = lehmer_position_mask(state->length);
+
+    // Allocate memory for generating seeds
+    state->sequence = (int32_t*) malloc(sizeof(int32_t) * state->length);
+    if (NULL == state->sequence) {
+        LOG_ERROR(
+            "Failed to allocate %u bytes to lehmer state sequence.\n",
+            state->length
+        );
+        free(state);
+        return NULL;
+    }
+
+    // Nothing is materialized yet; the seed getters extend on demand
+    state->filled = 0;
+    LEHMER_STATS_RESET(state);
 
     return state;
 }
 
+// Initialize a caller-owned state without allocating
+void lehmer_state_init(
+    lehmer_state_t* state, int32_t* sequence, uint32_t length, int32_t seed
+) {
+    // Zero-initialize the index
+    state->position = 0;
+    // Default to a seed of 123456789 if seed is 0
+    state->seed = (0 >= seed) ? LEHMER_SEED : seed % LEHMER_MODULUS;
+    LEHMER_STATS_RESET(state);
+
+    // Without a caller-owned buffer, fall back to the lean single-seed mode
+    if (NULL == sequence || 0 == length) {
+        state->length = 1;
+        state->mask = lehmer_position_mask(state->length);
+        state->sequence = &state->scalar;
+        state->sequence[0] = state->seed;
+        state->filled = 1;
+        return;
+    }
+
+    // Adopt the caller-owned buffer; the caller retains ownership
+    state->length = length;
+    state->mask = lehmer_position_mask(state->length);
+    state->sequence = sequence;
+
+    // Initialize the state object
+    lehmer_generate(state, lehmer_generate_modulo, state->seed);
+}
+
 // Free the allocated memory
 void lehmer_state_free(lehmer_state_t* state) {
     if (state) {
-        if (state->sequence) {
+        // Lean states point the sequence at the inline slot
+        if (state->sequence && state->sequence != &state->scalar) {
             free(state->sequence);
         }
         free(state);
@@ -108,28 +270,95 @@ int32_t lehmer_get_initial_seed(lehmer_state_t* state) {
     return state->seed % LEHMER_MODULUS;
 }
 
+/**
+ * @brief Bind a cursor to the ring boundary.
+ *
+ * Masked mode (power-of-two lengths, including the default LEHMER_SIZE)
+ * compiles to a single AND and absorbs unsigned wraparound for free.
+ * Other lengths fall back to the integer modulo, which keeps a division
+ * on the per-draw critical path, so power-of-two lengths are preferred.
+ */
+static inline uint32_t lehmer_position_bind(
+    const lehmer_state_t* state, uint32_t position
+) {
+    if (state->mask) {
+        return position & state->mask;
+    }
+    return position % state->length;
+}
+
 // Set the previous seed in the generated sequence
 void lehmer_set_previous_seed(lehmer_state_t* state) {
-    // Bind the position to the sequence length
-    state->position = (state->position - 1) % state->length;
+    // Masked rings absorb the unsigned underflow at position 0; the
+    // modulo fallback must wrap explicitly since position is unsigned
+    if (0 == state->position) {
+        LEHMER_STATS_ADD(state, wraps, 1);
+    }
+    if (state->mask) {
+        state->position = (state->position - 1) & state->mask;
+    } else {
+        state->position
+            = (0 == state->position) ? state->length - 1 : state->position - 1;
+    }
 }
 
 // Set the next seed in the generated sequence
 void lehmer_set_next_seed(lehmer_state_t* state) {
-    // Bind the position to the sequence length
-    state->position = (state->position + 1) % state->length;
+    if (state->length - 1 == state->position) {
+        LEHMER_STATS_ADD(state, wraps, 1);
+    }
+    // Bind the position to the ring boundary
+    state->position = lehmer_position_bind(state, state->position + 1);
+}
+
+/**
+ * @brief Extend the materialized prefix of a lazy sequence up to position.
+ *
+ * Eagerly generated states keep `filled == length`, so this is a single
+ * compare on the hot path. Lazy states pay for exactly the prefix they
+ * touch, one recurrence step per newly materialized entry.
+ */
+static void lehmer_materialize(lehmer_state_t* state, uint32_t position) {
+    if (position < state->filled) {
+        return;
+    }
+
+    // The first entry derives from the root seed
+    if (0 == state->filled) {
+        state->sequence[0] = lehmer_inline_modulo(state->seed);
+        state->filled = 1;
+    }
+
+    // Extend the prefix one recurrence step at a time
+    for (uint32_t current = state->filled; current <= position; current++) {
+        state->sequence[current]
+            = lehmer_inline_modulo(state->sequence[current - 1]);
+    }
+    state->filled = position + 1;
 }
 
 // Get the current seed in the sequence with boundary enforcement
 int32_t lehmer_get_current_seed(lehmer_state_t* state) {
-    // Bind the position to the sequence length
-    state->position %= state->length;
+    // Bind the position to the ring boundary
+    state->position = lehmer_position_bind(state, state->position);
+    // Extend the materialized prefix if the position crossed it (lazy mode)
+    lehmer_materialize(state, state->position);
+    // Cache-resident sequences: pull the next ring entry toward L1 while
+    // the caller consumes this one. Gated on the mask so the next index
+    // is a single AND; non-power-of-two lengths skip the hint rather
+    // than pay a division on every draw
+    if (state->mask && !lehmer_sequence_exceeds_budget(state->length)) {
+        LEHMER_PREFETCH(
+            &state->sequence[(state->position + 1) & state->mask]
+        );
+    }
     // Get the current seed from the sequence
     return state->sequence[state->position];
 }
 
 // Get the current seed in the sequence with boundary enforcement
 int32_t lehmer_set_next_and_get_seed(lehmer_state_t* state) {
+    LEHMER_STATS_ADD(state, draws, 1);
     // Set the next seed
     lehmer_set_next_seed(state);
     // Get the current seed from the sequence
@@ -143,10 +372,19 @@ float lehmer_seed_normalize_to_float(int32_t seed) {
     return (float) seed / (float) LEHMER_MODULUS;
 }
 
+// @brief Normalizes a seed to a double in the range 0.0 to 1.0
+double lehmer_seed_normalize_to_double(int32_t seed) {
+    // Multiply by the precomputed reciprocal; the double mantissa keeps all
+    // 31 bits of the seed
+    return (double) seed * (1.0 / (double) LEHMER_MODULUS);
+}
+
 // @brief Normalizes a seed to a integer in the range 0 to m - 1
 int32_t lehmer_seed_normalize_to_int(int32_t seed) {
     // Bind the seed to the modulus
-    return seed % LEHMER_MODULUS;
+    seed %= LEHMER_MODULUS;
+    // Map negative residues (e.g. Schrage's gamma) back into the range
+    return (0 > seed) ? seed + LEHMER_MODULUS : seed;
 }
 
 // Lehmer seed calculators
@@ -183,10 +421,8 @@ int32_t lehmer_calculate_binder(int32_t z, uint32_t a, uint32_t m) {
 
 // Generate the seed using modulo formula
 int32_t lehmer_generate_modulo(int32_t seed) {
-    uint32_t a = LEHMER_MULTIPLIER;
-    uint32_t m = LEHMER_MODULUS;
-    int32_t z = lehmer_calculate_modulo(seed, a, m);
-    return lehmer_seed_normalize_to_int(z);
+    // Defer to the specialized inline core so a and m constant-propagate
+    return lehmer_inline_modulo(seed);
 }
 
 int32_t lehmer_generate_gamma(int32_t seed) {
@@ -219,6 +455,152 @@ int32_t lehmer_generate_binder(int32_t seed) {
 
 // Lehmer seed generators
 
+// Compute a^k mod m using square-and-multiply with 64-bit intermediates
+static int64_t lehmer_multiplier_power(uint64_t a, uint64_t k, uint64_t m) {
+    uint64_t result = 1;
+    a %= m;
+
+    while (0 < k) {
+        if (k & 1) {
+            result = (result * a) % m;
+        }
+        k >>= 1; // Right-shift k by 1 (dividing by 2)
+        a = (a * a) % m; // Square a and reduce modulo m
+    }
+
+    return (int64_t) result;
+}
+
+/**
+ * @param LEHMER_JUMP_TABLE_BITS Power-of-two table depth for jump-ahead.
+ *
+ * Exponents reduce modulo the period m - 1 < 2^31, so 31 doubling powers
+ * cover every reachable offset.
+ */
+#define LEHMER_JUMP_TABLE_BITS 31
+
+/**
+ * @param LEHMER_JUMP_TABLE_SMALL Direct powers a^1, ..., a^256 for the
+ * short jumps schedulers issue constantly; one lookup, zero multiplies.
+ */
+#define LEHMER_JUMP_TABLE_SMALL 256
+
+// Precomputed multiplier powers shared by every state: a and m are
+// compile-time constants, so one table serves the whole process
+static uint64_t lehmer_jump_doubling[LEHMER_JUMP_TABLE_BITS]; // a^(2^j)
+static uint64_t lehmer_jump_direct[LEHMER_JUMP_TABLE_SMALL]; // a^1..a^256
+
+// Build both jump tables at load time: 31 squarings plus 256 multiplies.
+// Eager construction keeps lehmer_at() honest about needing no shared
+// mutable state — lazy init behind a plain flag raced when two workers
+// made their first jump concurrently
+__attribute__((constructor)) static void lehmer_jump_table_init(void) {
+    uint64_t power = LEHMER_MULTIPLIER;
+    for (uint32_t j = 0; j < LEHMER_JUMP_TABLE_BITS; j++) {
+        lehmer_jump_doubling[j] = power;
+        power = (power * power) % LEHMER_MODULUS;
+    }
+
+    power = LEHMER_MULTIPLIER;
+    for (uint32_t k = 0; k < LEHMER_JUMP_TABLE_SMALL; k++) {
+        lehmer_jump_direct[k] = power;
+        power = (power * LEHMER_MULTIPLIER) % LEHMER_MODULUS;
+    }
+}
+
+/**
+ * @brief Compute a^k mod m from the precomputed jump tables.
+ *
+ * Small common jumps (k <= 256) are a single lookup; anything else is at
+ * most popcount(k) table multiplies with zero modular exponentiation at
+ * jump time. The default multiplier is a primitive root, so exponents
+ * reduce modulo the period m - 1 first.
+ */
+static int64_t lehmer_jump_power(uint64_t k) {
+    k %= LEHMER_MODULUS - 1; // a^(m - 1) = 1 for a primitive root
+    if (0 == k) {
+        return 1;
+    }
+    if (LEHMER_JUMP_TABLE_SMALL >= k) {
+        return (int64_t) lehmer_jump_direct[k - 1];
+    }
+
+    uint64_t result = 1;
+    for (uint32_t j = 0; 0 < k; j++, k >>= 1) {
+        if (k & 1) {
+            result = (result * lehmer_jump_doubling[j]) % LEHMER_MODULUS;
+        }
+    }
+
+    return (int64_t) result;
+}
+
+/**
+ * @brief Vectorizable fill kernel for the modulo generator.
+ *
+ * The scalar loop in lehmer_generate() is strictly serial because each
+ * element depends on its predecessor. The modulo generator, however, is a
+ * pure multiplication modulo m, so k steps collapse into a single multiply
+ * by a^k mod m. Splitting the sequence into LEHMER_LANES lanes makes each
+ * element depend only on the element LEHMER_LANES positions behind it,
+ * which the compiler can vectorize with AVX2/NEON integer multiplies.
+ *
+ * Produces a sequence identical to the scalar loop.
+ */
+static void lehmer_generate_lanes(lehmer_state_t* state) {
+    // The multiplier that advances a seed by LEHMER_LANES steps at once
+    const int64_t jump = lehmer_multiplier_power(
+        LEHMER_MULTIPLIER, LEHMER_LANES, LEHMER_MODULUS
+    );
+
+    // Seed the lanes with the first LEHMER_LANES values (scalar prologue)
+    state->sequence[0] = lehmer_generate_modulo(state->seed);
+    for (uint32_t current = 1; current < LEHMER_LANES; current++) {
+        state->sequence[current]
+            = lehmer_generate_modulo(state->sequence[current - 1]);
+    }
+
+    // Advance each lane independently by LEHMER_LANES steps per element
+    for (uint32_t current = LEHMER_LANES; current < state->length; current++) {
+        state->sequence[current] = (int32_t
+        ) ((jump * state->sequence[current - LEHMER_LANES]) % LEHMER_MODULUS);
+    }
+}
+
+/**
+ * @brief Lane kernel variant with non-temporal stores.
+ *
+ * Produces the same sequence as lehmer_generate_lanes() but writes every
+ * element past the cache hierarchy, so refilling a sequence larger than
+ * LEHMER_CACHE_BUDGET does not evict the caller's working set. The lanes
+ * live in a local ring because non-temporal lines must never be read
+ * back: doing so would stall on the write-combining buffers.
+ */
+static void lehmer_generate_lanes_stream(lehmer_state_t* state) {
+    // The multiplier that advances a seed by LEHMER_LANES steps at once
+    const int64_t jump = lehmer_multiplier_power(
+        LEHMER_MULTIPLIER, LEHMER_LANES, LEHMER_MODULUS
+    );
+
+    // Seed the lanes with the first LEHMER_LANES values (scalar prologue)
+    int32_t lane[LEHMER_LANES];
+    lane[0] = lehmer_generate_modulo(state->seed);
+    lehmer_sequence_stream(&state->sequence[0], lane[0]);
+    for (uint32_t current = 1; current < LEHMER_LANES; current++) {
+        lane[current] = lehmer_generate_modulo(lane[current - 1]);
+        lehmer_sequence_stream(&state->sequence[current], lane[current]);
+    }
+
+    // Advance each lane independently by LEHMER_LANES steps per element
+    for (uint32_t current = LEHMER_LANES; current < state->length; current++) {
+        uint32_t slot = current & (LEHMER_LANES - 1);
+        lane[slot] = (int32_t) ((jump * lane[slot]) % LEHMER_MODULUS);
+        lehmer_sequence_stream(&state->sequence[current], lane[slot]);
+    }
+
+    lehmer_sequence_stream_fence();
+}
+
 // Generalized Lehmer sequence generator
 void lehmer_generate(
     lehmer_state_t* state, lehmer_generate_t generator, int32_t seed
@@ -226,6 +608,48 @@ void lehmer_generate(
     // Set the initial seed within the range of the modulus
     state->seed = seed % LEHMER_MODULUS;
 
+    // Every path below materializes the full sequence
+    state->filled = state->length;
+
+    // Refills past the cache budget use non-temporal stores so a
+    // mid-timestep regeneration does not evict the caller's working set
+    bool stream = lehmer_sequence_exceeds_budget(state->length);
+
+    // The modulo generator admits jump-ahead; use the lane kernel when the
+    // sequence is long enough to amortize the scalar prologue
+    if (lehmer_generate_modulo == generator) {
+        if (state->length >= 2 * LEHMER_LANES) {
+            if (stream) {
+                lehmer_generate_lanes_stream(state);
+            } else {
+                lehmer_generate_lanes(state);
+            }
+            return;
+        }
+
+        // Short sequences: bypass the function pointer so the specialized
+        // inline core can constant-fold the multiplier and modulus
+        state->sequence[0] = lehmer_inline_modulo(state->seed);
+        for (uint32_t current = 1; current < state->length; current++) {
+            state->sequence[current]
+                = lehmer_inline_modulo(state->sequence[current - 1]);
+        }
+        return;
+    }
+
+    // Streamed generic fill: the running seed stays in a register because
+    // non-temporal lines must never be read back
+    if (stream) {
+        int32_t previous_seed = generator(state->seed);
+        lehmer_sequence_stream(&state->sequence[0], previous_seed);
+        for (uint32_t current = 1; current < state->length; current++) {
+            previous_seed = generator(previous_seed % LEHMER_MODULUS);
+            lehmer_sequence_stream(&state->sequence[current], previous_seed);
+        }
+        lehmer_sequence_stream_fence();
+        return;
+    }
+
     // Generate the first value in the sequence based on the initial seed
     state->sequence[0] = generator(state->seed);
 
@@ -256,12 +680,33 @@ void lehmer_generate_time(lehmer_state_t* state, lehmer_generate_t generator) {
 }
 
 void lehmer_regenerate(lehmer_state_t* state, lehmer_generate_t generator) {
+    LEHMER_STATS_ADD(state, regenerations, 1);
     // Get the selected seed in the sequence
     int32_t seed = lehmer_set_next_and_get_seed(state);
     // Generate a new sequence based on the selected seed
     lehmer_generate(state, generator, seed);
 }
 
+// Advance the state by k steps of the modulo recurrence via the tables
+void lehmer_state_jump(lehmer_state_t* state, uint64_t k) {
+    // Collapse k steps into a single multiplier: a^k mod m
+    int64_t jump = lehmer_jump_power(k);
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_get_current_seed(state);
+    // Apply the collapsed multiplier to jump ahead k steps
+    seed = (int32_t) ((jump * seed) % LEHMER_MODULUS);
+    // Regenerate the sequence from the jumped seed
+    lehmer_generate(state, lehmer_generate_modulo, seed);
+}
+
+// Compute the i-th seed of a stream statelessly via the jump tables
+int32_t lehmer_at(int32_t seed, uint64_t i) {
+    // Collapse i steps into a single multiplier: a^i mod m
+    int64_t jump = lehmer_jump_power(i);
+    // Apply the collapsed multiplier; i == 0 yields the seed itself
+    return (int32_t) ((jump * (seed % LEHMER_MODULUS)) % LEHMER_MODULUS);
+}
+
 // Lehmer number generators
 
 // Generate a random number using the modulo approach.
@@ -298,6 +743,16 @@ float lehmer_random_delta(lehmer_state_t* state) {
     return lehmer_seed_normalize_to_float(seed);
 }
 
+// Generate a random number from a lean single-seed state
+float lehmer_random_lean(lehmer_state_t* state) {
+    LEHMER_STATS_ADD(state, draws, 1);
+    // Advance the stream in place; there is no pregenerated sequence
+    int32_t seed = lehmer_generate_modulo(state->sequence[0]);
+    state->sequence[0] = seed;
+    // Normalize and return
+    return lehmer_seed_normalize_to_float(seed);
+}
+
 // Generalized random number generation
 float lehmer_random(lehmer_state_t* state, lehmer_generate_t generator) {
     // Get the selected seed in the sequence
@@ -306,6 +761,680 @@ float lehmer_random(lehmer_state_t* state, lehmer_generate_t generator) {
     return lehmer_seed_normalize_to_float(seed);
 }
 
+// Lehmer bounded integer generators
+
+/**
+ * @brief Lemire's multiply-shift rejection over the 31-bit seed space.
+ *
+ * The product seed * range splits into a high part (the candidate value)
+ * and a low part. Rejecting low parts below (2^31 - range) % range makes
+ * every candidate equally likely, eliminating the modulo bias of
+ * `seed % range` without a division in the common case.
+ */
+static uint32_t lehmer_bounded_reject(
+    uint32_t seed, uint32_t range, bool* accepted
+) {
+    uint64_t product = (uint64_t) seed * range;
+    uint32_t low = (uint32_t) product & 0x7FFFFFFFU;
+
+    if (low < range) {
+        // Rare path: compute the rejection threshold (one division)
+        uint32_t threshold = (0x80000000U - range) % range;
+        if (low < threshold) {
+            *accepted = false;
+            return 0;
+        }
+    }
+
+    *accepted = true;
+    return (uint32_t) (product >> 31);
+}
+
+// Generate a uniform random integer in the range 0 to range - 1
+uint32_t lehmer_random_bounded(lehmer_state_t* state, uint32_t range) {
+    if (0 == range) {
+        return 0;
+    }
+
+    for (;;) {
+        // Get the selected seed in the sequence
+        int32_t seed = lehmer_set_next_and_get_seed(state);
+        seed = lehmer_generate_modulo(seed);
+
+        bool accepted = false;
+        uint32_t value = lehmer_bounded_reject((uint32_t) seed, range, &accepted);
+        if (accepted) {
+            return value;
+        }
+    }
+}
+
+// Fill a caller-provided buffer with bounded integers in one call
+void lehmer_random_bounded_fill(
+    lehmer_state_t* state, uint32_t range, uint32_t* buffer, size_t size
+) {
+    if (NULL == buffer || 0 == size || 0 == range) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    // Advance the recurrence in a local variable, as lehmer_seed_fill does
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        bool accepted = false;
+        uint32_t value;
+        do {
+            seed = lehmer_generate_modulo(seed);
+            value = lehmer_bounded_reject((uint32_t) seed, range, &accepted);
+        } while (!accepted);
+        buffer[i] = value;
+    }
+
+    // Write the final seed back so per-call draws continue the stream
+    state->sequence[state->position] = seed;
+}
+
+// Lehmer shuffling and sampling
+
+// Draw a bounded integer from a local seed, advancing it past rejections
+static inline uint32_t lehmer_seed_bounded(int32_t* seed, uint32_t range) {
+    for (;;) {
+        *seed = lehmer_inline_modulo(*seed);
+
+        bool accepted = false;
+        uint32_t value
+            = lehmer_bounded_reject((uint32_t) *seed, range, &accepted);
+        if (accepted) {
+            return value;
+        }
+    }
+}
+
+// Shuffle an array in place with an unbiased Fisher-Yates pass
+void lehmer_shuffle(
+    lehmer_state_t* state, void* base, size_t n, size_t elem_size
+) {
+    if (NULL == base || 0 == elem_size || 2 > n) {
+        return;
+    }
+    if (0x7FFFFFFF < n) {
+        LOG_ERROR("Shuffle size must be below the 31-bit seed space.\n");
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, n - 1);
+
+    uint8_t* bytes = (uint8_t*) base;
+
+    // Advance the recurrence in a local variable, as lehmer_seed_fill does
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = n - 1; 0 < i; i--) {
+        // Draw a partner index uniformly from 0, ..., i
+        uint32_t j = lehmer_seed_bounded(&seed, (uint32_t) i + 1);
+        if ((size_t) j == i) {
+            continue;
+        }
+
+        uint8_t* a = bytes + i * elem_size;
+        uint8_t* b = bytes + j * elem_size;
+        for (size_t byte = 0; byte < elem_size; byte++) {
+            uint8_t swap = a[byte];
+            a[byte] = b[byte];
+            b[byte] = swap;
+        }
+    }
+
+    // Write the final seed back so per-call draws continue the stream
+    state->sequence[state->position] = seed;
+}
+
+// Sample k distinct indices from 0, ..., n - 1 without replacement
+void lehmer_sample_k(
+    lehmer_state_t* state, uint32_t n, uint32_t k, uint32_t* out
+) {
+    if (NULL == out || 0 == k) {
+        return;
+    }
+    if (k > n) {
+        LOG_ERROR("Sample size must not exceed the population size.\n");
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, k);
+
+    // Selection sampling (Knuth's Algorithm S): keep index i with
+    // probability (k - chosen) / (n - i), which emits exactly k indices
+    // in increasing order with every k-subset equally likely
+    int32_t seed = lehmer_get_current_seed(state);
+    uint32_t chosen = 0;
+    for (uint32_t i = 0; i < n && chosen < k; i++) {
+        uint32_t draw = lehmer_seed_bounded(&seed, n - i);
+        if (draw < k - chosen) {
+            out[chosen++] = i;
+        }
+    }
+
+    state->sequence[state->position] = seed;
+}
+
+// Lehmer double-precision random number generators
+
+// Generate a double-precision random number using the modulo approach.
+double lehmer_random_modulo_d(lehmer_state_t* state) {
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_set_next_and_get_seed(state);
+    seed = lehmer_generate_modulo(seed);
+    return lehmer_seed_normalize_to_double(seed);
+}
+
+// Generate a double-precision random number using the gamma approach.
+double lehmer_random_gamma_d(lehmer_state_t* state) {
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_set_next_and_get_seed(state);
+    seed = lehmer_generate_gamma(seed);
+    return lehmer_seed_normalize_to_double(seed);
+}
+
+// Generate a double-precision random number using the jump approach.
+double lehmer_random_jump_d(lehmer_state_t* state) {
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_set_next_and_get_seed(state);
+    seed = lehmer_generate_jump(seed);
+    return lehmer_seed_normalize_to_double(seed);
+}
+
+// Generate a double-precision random number using the delta approach.
+double lehmer_random_delta_d(lehmer_state_t* state) {
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_set_next_and_get_seed(state);
+    seed = lehmer_generate_delta(seed);
+    return lehmer_seed_normalize_to_double(seed);
+}
+
+// Generalized double-precision random number generation
+double lehmer_random_d(lehmer_state_t* state, lehmer_generate_t generator) {
+    // Get the selected seed in the sequence
+    int32_t seed = lehmer_set_next_and_get_seed(state);
+    seed = generator(seed);
+    return lehmer_seed_normalize_to_double(seed);
+}
+
+// Lehmer bulk generation
+
+// Fill a caller-provided buffer with raw seeds in a single call
+void lehmer_seed_fill(lehmer_state_t* state, int32_t* buffer, size_t size) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    // Advance the recurrence in a local variable to skip the per-draw
+    // position bookkeeping
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        seed = lehmer_generate_modulo(seed);
+        buffer[i] = seed;
+    }
+
+    // Write the final seed back so per-call draws continue the stream
+    state->sequence[state->position] = seed;
+}
+
+// Fill a caller-provided buffer with normalized floats in a single call
+void lehmer_random_fill(lehmer_state_t* state, float* buffer, size_t size) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        seed = lehmer_generate_modulo(seed);
+        buffer[i] = lehmer_seed_normalize_to_float(seed);
+    }
+
+    state->sequence[state->position] = seed;
+}
+
+// Fill a caller-provided buffer with normalized doubles in a single call
+void lehmer_random_fill_d(lehmer_state_t* state, double* buffer, size_t size) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        seed = lehmer_generate_modulo(seed);
+        buffer[i] = lehmer_seed_normalize_to_double(seed);
+    }
+
+    state->sequence[state->position] = seed;
+}
+
+// Lehmer stream output
+
+// Wait for an in-flight write and finish any partial write synchronously
+static bool lehmer_stream_wait(struct aiocb* control) {
+    const struct aiocb* list[1] = {control};
+    while (EINPROGRESS == aio_error(control)) {
+        aio_suspend(list, 1, NULL);
+    }
+
+    if (0 != aio_error(control)) {
+        LOG_ERROR("Asynchronous stream write failed.\n");
+        return false;
+    }
+
+    // Short writes are legal; drain the remainder at the position the
+    // async write reached. The descriptor's own offset is unspecified
+    // after aio_write(), so a plain write would land in the wrong place
+    // on a regular file; pwrite() targets aio_offset directly and pipes
+    // (which reject pwrite with ESPIPE) fall back to write()
+    size_t total = control->aio_nbytes;
+    size_t done = (size_t) aio_return(control);
+    const uint8_t* base = (const uint8_t*) control->aio_buf;
+    while (done < total) {
+        ssize_t written = pwrite(
+            control->aio_fildes,
+            base + done,
+            total - done,
+            control->aio_offset + (off_t) done
+        );
+        if (0 > written && ESPIPE == errno) {
+            written = write(control->aio_fildes, base + done, total - done);
+        }
+        if (0 > written) {
+            LOG_ERROR("Failed to drain a short stream write.\n");
+            return false;
+        }
+        done += (size_t) written;
+    }
+
+    return true;
+}
+
+// Stream raw float variates to a file descriptor with ping-pong buffers
+bool lehmer_stream_to_fd(
+    lehmer_state_t* state, lehmer_generate_t generator, int fd, size_t n_bytes
+) {
+    if (NULL == state || NULL == generator || 0 > fd) {
+        LOG_ERROR("Stream state, generator, and descriptor must be valid.\n");
+        return false;
+    }
+
+    // Round down to whole floats; partial variates are meaningless
+    size_t remaining = n_bytes / sizeof(float);
+    if (0 == remaining) {
+        return true;
+    }
+
+    float* buffers[2];
+    buffers[0] = (float*) malloc(LEHMER_STREAM_BUFFER);
+    buffers[1] = (float*) malloc(LEHMER_STREAM_BUFFER);
+    if (NULL == buffers[0] || NULL == buffers[1]) {
+        LOG_ERROR("Failed to allocate memory to stream buffers.\n");
+        free(buffers[0]);
+        free(buffers[1]);
+        return false;
+    }
+
+    // Track the file offset ourselves; pipes ignore it
+    off_t offset = lseek(fd, 0, SEEK_CUR);
+    if (0 > offset) {
+        offset = 0;
+    }
+
+    struct aiocb control = {0};
+    control.aio_fildes = fd;
+
+    // Advance the recurrence in a local variable, as lehmer_seed_fill does
+    int32_t seed = lehmer_get_current_seed(state);
+    bool in_flight = false;
+    bool passed = true;
+    uint32_t which = 0;
+
+    while (0 < remaining) {
+        // Generate the next chunk while the previous one is in flight
+        size_t chunk = LEHMER_STREAM_BUFFER / sizeof(float);
+        if (remaining < chunk) {
+            chunk = remaining;
+        }
+
+        LEHMER_STATS_ADD(state, draws, chunk);
+
+        float* buffer = buffers[which];
+        for (size_t i = 0; i < chunk; i++) {
+            seed = generator(seed);
+            buffer[i] = lehmer_seed_normalize_to_float(seed);
+        }
+
+        // Reclaim the other buffer before submitting this one
+        if (in_flight && !lehmer_stream_wait(&control)) {
+            passed = false;
+            break;
+        }
+
+        control.aio_buf = buffer;
+        control.aio_nbytes = chunk * sizeof(float);
+        control.aio_offset = offset;
+        if (0 != aio_write(&control)) {
+            LOG_ERROR("Failed to submit an asynchronous stream write.\n");
+            passed = false;
+            break;
+        }
+
+        in_flight = true;
+        offset += (off_t) (chunk * sizeof(float));
+        remaining -= chunk;
+        which ^= 1; // Swap the ping-pong buffers
+    }
+
+    // Reclaim the final in-flight write before releasing its buffer
+    if (in_flight && passed) {
+        passed = lehmer_stream_wait(&control);
+    }
+
+    free(buffers[0]);
+    free(buffers[1]);
+
+    // Write the final seed back so per-call draws continue the stream
+    if (passed) {
+        state->sequence[state->position] = seed;
+    }
+
+    return passed;
+}
+
+// Lehmer state persistence
+
+// Write a state to a file descriptor in the snapshot format
+bool lehmer_state_save(lehmer_state_t* state, int fd) {
+    // Lazy states must be fully materialized before the raw dump
+    lehmer_materialize(state, state->length - 1);
+
+    lehmer_snapshot_header_t header = {
+        .magic = LEHMER_SNAPSHOT_MAGIC,
+        .version = LEHMER_SNAPSHOT_VERSION,
+        .seed = state->seed,
+        .length = state->length,
+        .position = state->position,
+        .reserved = 0,
+    };
+
+    // Write the fixed-layout header, then the raw sequence
+    ssize_t written = write(fd, &header, sizeof(header));
+    if (sizeof(header) != (size_t) written) {
+        LOG_ERROR("Failed to write lehmer snapshot header.\n");
+        return false;
+    }
+
+    size_t bytes = sizeof(int32_t) * state->length;
+    written = write(fd, state->sequence, bytes);
+    if (bytes != (size_t) written) {
+        LOG_ERROR("Failed to write lehmer snapshot sequence.\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Initialize a caller-owned state from a mapped snapshot, in place
+bool lehmer_state_map(lehmer_state_t* state, void* addr) {
+    lehmer_snapshot_header_t* header = (lehmer_snapshot_header_t*) addr;
+
+    if (NULL == header || LEHMER_SNAPSHOT_MAGIC != header->magic) {
+        LOG_ERROR("Address does not hold a lehmer snapshot.\n");
+        return false;
+    }
+    if (LEHMER_SNAPSHOT_VERSION != header->version) {
+        LOG_ERROR(
+            "Unsupported lehmer snapshot version %u.\n", header->version
+        );
+        return false;
+    }
+    // A zero length would arm a full mask (0 counts as a power of two)
+    // and let the cursor index arbitrarily far past the mapping
+    if (0 == header->length) {
+        LOG_ERROR("Lehmer snapshot length must be greater than 0.\n");
+        return false;
+    }
+    if (header->position >= header->length) {
+        LOG_ERROR(
+            "Lehmer snapshot position %u is out of range for length %u.\n",
+            header->position,
+            header->length
+        );
+        return false;
+    }
+
+    // Adopt the mapped sequence with zero deserialization
+    state->seed = header->seed;
+    state->length = header->length;
+    state->mask = lehmer_position_mask(state->length);
+    state->position = header->position;
+    state->filled = header->length; // Snapshots are fully materialized
+    state->sequence = (int32_t*) (header + 1);
+    LEHMER_STATS_RESET(state);
+
+    return true;
+}
+
+// Lehmer parallel stream management
+
+// Create a pool of disjoint streams from one logical stream
+lehmer_stream_pool_t* lehmer_stream_pool_create(
+    uint32_t count, int32_t seed, uint32_t length, uint64_t stride
+) {
+    if (0 == count) {
+        LOG_ERROR("Stream pool count must be greater than 0.\n");
+        return NULL;
+    }
+
+    // Default to a stride of 2^24 if stride is 0
+    stride = (0 == stride) ? LEHMER_STRIDE : stride;
+
+    // Allocate memory for managing the pool
+    lehmer_stream_pool_t* pool
+        = (lehmer_stream_pool_t*) malloc(sizeof(lehmer_stream_pool_t));
+    if (NULL == pool) {
+        LOG_ERROR("Failed to allocate memory to lehmer stream pool.\n");
+        return NULL;
+    }
+
+    pool->count = count;
+    // Zero-initialize so a partial failure can be freed safely
+    pool->streams = (lehmer_state_t**) calloc(count, sizeof(lehmer_state_t*));
+    if (NULL == pool->streams) {
+        LOG_ERROR("Failed to allocate memory to lehmer pool streams.\n");
+        free(pool);
+        return NULL;
+    }
+
+    // Partition the logical stream: stream i starts i * stride steps in
+    for (uint32_t i = 0; i < count; i++) {
+        pool->streams[i] = lehmer_state_create(seed, length);
+        if (NULL == pool->streams[i]) {
+            lehmer_stream_pool_free(pool);
+            return NULL;
+        }
+        if (0 < i) {
+            lehmer_state_jump(pool->streams[i], (uint64_t) i * stride);
+        }
+    }
+
+    return pool;
+}
+
+// Get the state for a given stream index
+lehmer_state_t* lehmer_stream_pool_get(
+    lehmer_stream_pool_t* pool, uint32_t index
+) {
+    if (NULL == pool || index >= pool->count) {
+        return NULL;
+    }
+    return pool->streams[index];
+}
+
+// Create a bank of independent generator lanes in one contiguous array
+lehmer_bank_t* lehmer_bank_create(int32_t seed, uint32_t count) {
+    if (0 == count) {
+        LOG_ERROR("Bank lane count must be greater than 0.\n");
+        return NULL;
+    }
+
+    lehmer_bank_t* bank = (lehmer_bank_t*) malloc(sizeof(lehmer_bank_t));
+    if (NULL == bank) {
+        LOG_ERROR("Failed to allocate memory to Lehmer bank.\n");
+        return NULL;
+    }
+
+    // aligned_alloc requires the size to be a multiple of the alignment
+    size_t bytes = (size_t) count * sizeof(int32_t);
+    bytes = (bytes + LEHMER_BANK_ALIGNMENT - 1) & ~(size_t
+    ) (LEHMER_BANK_ALIGNMENT - 1);
+    bank->seeds = (int32_t*) aligned_alloc(LEHMER_BANK_ALIGNMENT, bytes);
+    if (NULL == bank->seeds) {
+        LOG_ERROR("Failed to allocate memory to Lehmer bank seeds.\n");
+        free(bank);
+        return NULL;
+    }
+
+    bank->count = count;
+
+    // Lane i starts i * LEHMER_STRIDE steps into the logical stream
+    for (uint32_t i = 0; i < count; i++) {
+        bank->seeds[i] = lehmer_at(seed, (uint64_t) i * LEHMER_STRIDE);
+    }
+
+    return bank;
+}
+
+// Advance every lane one step and optionally emit the draws
+void lehmer_bank_step_all(lehmer_bank_t* bank, float* out) {
+    // The lanes are independent, so the compiler can vectorize both loops
+    if (NULL == out) {
+        for (uint32_t i = 0; i < bank->count; i++) {
+            bank->seeds[i] = lehmer_inline_modulo(bank->seeds[i]);
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < bank->count; i++) {
+        bank->seeds[i] = lehmer_inline_modulo(bank->seeds[i]);
+        out[i] = lehmer_seed_normalize_to_float(bank->seeds[i]);
+    }
+}
+
+// Free the bank and its seed storage
+void lehmer_bank_free(lehmer_bank_t* bank) {
+    if (bank) {
+        if (bank->seeds) {
+            free(bank->seeds);
+        }
+        free(bank);
+    }
+}
+
+// Initialize a replay record for one stream
+void lehmer_record_init(
+    lehmer_record_t* record, int32_t seed, uint32_t stream
+) {
+    if (NULL == record) {
+        LOG_ERROR("Replay record must not be NULL.\n");
+        return;
+    }
+
+    record->seed = seed;
+    record->stream = stream;
+    record->draws = 0;
+}
+
+// Reconstruct the seed a stream held at an arbitrary draw index
+int32_t lehmer_replay_seek(const lehmer_record_t* record, uint64_t i) {
+    if (NULL == record) {
+        LOG_ERROR("Replay record must not be NULL.\n");
+        return 0;
+    }
+
+    // Two hops keep the exponent in range: first to the stream's start
+    // (matching the pool and bank lane layout), then to the draw index
+    int32_t start
+        = lehmer_at(record->seed, (uint64_t) record->stream * LEHMER_STRIDE);
+    return lehmer_at(start, i);
+}
+
+// Reconstruct a stream exactly where its worker left off
+int32_t lehmer_replay_open(const lehmer_record_t* record) {
+    if (NULL == record) {
+        LOG_ERROR("Replay record must not be NULL.\n");
+        return 0;
+    }
+
+    return lehmer_replay_seek(record, record->draws);
+}
+
+// Free the pool and every state it owns
+void lehmer_stream_pool_free(lehmer_stream_pool_t* pool) {
+    if (pool) {
+        if (pool->streams) {
+            for (uint32_t i = 0; i < pool->count; i++) {
+                lehmer_state_free(pool->streams[i]);
+            }
+            free(pool->streams);
+        }
+        free(pool);
+    }
+}
+
+// 64-bit Lehmer engine
+
+// Create and initialize a 64-bit Lehmer engine state
+lehmer64_state_t* lehmer64_state_create(uint64_t seed) {
+    lehmer64_state_t* state
+        = (lehmer64_state_t*) malloc(sizeof(lehmer64_state_t));
+    if (NULL == state) {
+        LOG_ERROR("Failed to allocate memory to lehmer64 state.\n");
+        return NULL;
+    }
+
+    // Default to a seed of 123456789 if seed is 0
+    state->seed = (0 == seed) ? LEHMER64_SEED : seed % LEHMER64_MODULUS;
+
+    return state;
+}
+
+// Free the allocated memory
+void lehmer64_state_free(lehmer64_state_t* state) {
+    if (state) {
+        free(state);
+    }
+}
+
+// 64-bit Lehmer function: f(z) = (a * z) % m
+uint64_t lehmer64_generate_modulo(uint64_t seed) {
+    // The product of two 61-bit values requires a 128-bit intermediate
+    return (uint64_t
+    ) (((__uint128_t) LEHMER64_MULTIPLIER * seed) % LEHMER64_MODULUS);
+}
+
+// @brief Normalizes a seed to a double in the range 0.0 to 1.0
+double lehmer64_seed_normalize_to_double(uint64_t seed) {
+    return (double) seed / (double) LEHMER64_MODULUS;
+}
+
+// Generate a random number using the 64-bit engine
+double lehmer64_random(lehmer64_state_t* state) {
+    // Advance the stream in place
+    state->seed = lehmer64_generate_modulo(state->seed);
+    // Normalize and return
+    return lehmer64_seed_normalize_to_double(state->seed);
+}
+
 // Lehmer probability functions
 
 static inline bool lehmer_is_valid_probability(float p) {
@@ -323,8 +1452,6 @@ int32_t lehmer_bernoulli(lehmer_state_t* state, float p) {
 }
 
 int32_t lehmer_binomial(lehmer_state_t* state, uint32_t n, float p) {
-    int32_t count = 0;
-
     // Validate p and n
     if (!lehmer_is_valid_probability(p)) {
         return (p <= 0.0) ? 0 : n; // All failures or all successes
@@ -333,10 +1460,311 @@ int32_t lehmer_binomial(lehmer_state_t* state, uint32_t n, float p) {
         return 0; // No trials, no successes
     }
 
-    // Sum up the results of n Bernoulli trials
-    for (uint32_t i = 0; i < n; ++i) {
-        count += lehmer_bernoulli(state, p);
+    // Inversion (BINV): walk the cumulative mass function with a single
+    // uniform draw instead of summing n Bernoulli trials. Expected cost is
+    // O(np) rather than O(n).
+    double q = 1.0 - (double) p;
+    double s = (double) p / q;
+    double f = pow(q, (double) n); // P(X = 0)
+
+    // For large n the starting mass underflows; fall back to the trial loop
+    if (0.0 >= f) {
+        int32_t count = 0;
+        for (uint32_t i = 0; i < n; ++i) {
+            count += lehmer_bernoulli(state, p);
+        }
+        return count;
+    }
+
+    double u = (double) lehmer_random_modulo(state);
+    double cumulative = f;
+    int32_t x = 0;
+
+    while (u > cumulative && x < (int32_t) n) {
+        x++;
+        // Recurrence: P(X = x) = P(X = x - 1) * s * (n - x + 1) / x
+        f *= s * ((double) (n - x + 1)) / ((double) x);
+        cumulative += f;
+    }
+
+    return x;
+}
+
+// Fill a caller-provided buffer with Bernoulli outcomes in one call
+void lehmer_bernoulli_fill(
+    lehmer_state_t* state, float p, int32_t* buffer, size_t size
+) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    if (!lehmer_is_valid_probability(p)) {
+        // Return edge case (0 or 1) based on probability
+        int32_t edge = (p <= 0.0) ? 0 : 1;
+        for (size_t i = 0; i < size; i++) {
+            buffer[i] = edge;
+        }
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    // Advance the recurrence in a local variable, as lehmer_seed_fill does
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        seed = lehmer_generate_modulo(seed);
+        buffer[i] = (lehmer_seed_normalize_to_float(seed) < p) ? 1 : 0;
+    }
+
+    // Write the final seed back so per-call draws continue the stream
+    state->sequence[state->position] = seed;
+}
+
+// Fill a caller-provided buffer with Binomial variates in one call
+void lehmer_binomial_fill(
+    lehmer_state_t* state, uint32_t n, float p, int32_t* buffer, size_t size
+) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = lehmer_binomial(state, n, p);
+    }
+}
+
+// Ziggurat tables (Marsaglia & Tsang, 2000): layers of equal area stacked
+// under the target density. x is the right edge of each layer and y the
+// density at that edge, so the common path is one table compare.
+
+#define LEHMER_ZIGGURAT_NORMAL_LAYERS 128
+#define LEHMER_ZIGGURAT_NORMAL_R 3.442619855899
+#define LEHMER_ZIGGURAT_NORMAL_AREA 9.91256303526217e-3
+
+#define LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS 256
+#define LEHMER_ZIGGURAT_EXPONENTIAL_R 7.69711747013104972
+#define LEHMER_ZIGGURAT_EXPONENTIAL_AREA 3.949659822581572e-3
+
+static double lehmer_ziggurat_normal_x[LEHMER_ZIGGURAT_NORMAL_LAYERS];
+static double lehmer_ziggurat_normal_y[LEHMER_ZIGGURAT_NORMAL_LAYERS];
+static double lehmer_ziggurat_exponential_x[LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS];
+static double lehmer_ziggurat_exponential_y[LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS];
+
+// Build both table sets at load time; the recurrences walk inward from the
+// tail edge. The tables are pure functions of the constants above, so eager
+// construction costs a few hundred transcendentals once and leaves nothing
+// for concurrent first callers to race on.
+__attribute__((constructor)) static void lehmer_ziggurat_init(void) {
+    // Normal: f(x) = exp(-x^2 / 2), layer area includes the tail at layer 0
+    double r = LEHMER_ZIGGURAT_NORMAL_R;
+    double v = LEHMER_ZIGGURAT_NORMAL_AREA;
+    double x = r;
+
+    lehmer_ziggurat_normal_x[LEHMER_ZIGGURAT_NORMAL_LAYERS - 1] = r;
+    lehmer_ziggurat_normal_y[LEHMER_ZIGGURAT_NORMAL_LAYERS - 1]
+        = exp(-0.5 * r * r);
+    for (uint32_t i = LEHMER_ZIGGURAT_NORMAL_LAYERS - 2; i >= 1; i--) {
+        x = sqrt(-2.0 * log(v / x + exp(-0.5 * x * x)));
+        lehmer_ziggurat_normal_x[i] = x;
+        lehmer_ziggurat_normal_y[i] = exp(-0.5 * x * x);
+    }
+    // Layer 0 is the base strip; its pseudo width absorbs the tail area
+    lehmer_ziggurat_normal_x[0] = v / exp(-0.5 * r * r);
+    lehmer_ziggurat_normal_y[0] = 1.0;
+
+    // Exponential: f(x) = exp(-x), same construction with 256 layers
+    r = LEHMER_ZIGGURAT_EXPONENTIAL_R;
+    v = LEHMER_ZIGGURAT_EXPONENTIAL_AREA;
+    x = r;
+
+    lehmer_ziggurat_exponential_x[LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS - 1] = r;
+    lehmer_ziggurat_exponential_y[LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS - 1]
+        = exp(-r);
+    for (uint32_t i = LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS - 2; i >= 1; i--) {
+        x = -log(v / x + exp(-x));
+        lehmer_ziggurat_exponential_x[i] = x;
+        lehmer_ziggurat_exponential_y[i] = exp(-x);
+    }
+    lehmer_ziggurat_exponential_x[0] = v / exp(-r);
+    lehmer_ziggurat_exponential_y[0] = 1.0;
+}
+
+// Advance a local seed and normalize, mirroring the bulk fill inner loop
+static inline double lehmer_ziggurat_uniform(int32_t* seed) {
+    *seed = lehmer_inline_modulo(*seed);
+    return lehmer_seed_normalize_to_double(*seed);
+}
+
+// Ziggurat core for the standard normal, advancing a local seed
+static double lehmer_ziggurat_normal(int32_t* seed) {
+    for (;;) {
+        // One draw picks the layer, one draw places the candidate
+        *seed = lehmer_inline_modulo(*seed);
+        uint32_t i = (uint32_t) *seed & (LEHMER_ZIGGURAT_NORMAL_LAYERS - 1);
+        double u = 2.0 * lehmer_ziggurat_uniform(seed) - 1.0;
+        double x = u * lehmer_ziggurat_normal_x[i];
+
+        // Common path: the candidate is inside the layer's inner rectangle.
+        // Layer 1 has no layer above it and x[0] holds the base strip's
+        // pseudo width, not a rectangle bound, so it always wedge-tests
+        if (1 < i && fabs(x) < lehmer_ziggurat_normal_x[i - 1]) {
+            return x;
+        }
+
+        if (0 == i) {
+            if (fabs(x) < LEHMER_ZIGGURAT_NORMAL_R) {
+                return x; // Base strip below the tail edge
+            }
+            // Tail: Marsaglia's exponential rejection beyond r
+            double tail_x, tail_y;
+            do {
+                tail_x = -log(lehmer_ziggurat_uniform(seed))
+                         / LEHMER_ZIGGURAT_NORMAL_R;
+                tail_y = -log(lehmer_ziggurat_uniform(seed));
+            } while (tail_y + tail_y < tail_x * tail_x);
+            tail_x += LEHMER_ZIGGURAT_NORMAL_R;
+            return (u < 0.0) ? -tail_x : tail_x;
+        }
+
+        // Wedge: accept against the density between the layer edges
+        double y = lehmer_ziggurat_normal_y[i]
+                   + lehmer_ziggurat_uniform(seed)
+                         * (lehmer_ziggurat_normal_y[i - 1]
+                            - lehmer_ziggurat_normal_y[i]);
+        if (y < exp(-0.5 * x * x)) {
+            return x;
+        }
+    }
+}
+
+// Ziggurat core for the rate-1 exponential, advancing a local seed
+static double lehmer_ziggurat_exponential(int32_t* seed) {
+    for (;;) {
+        *seed = lehmer_inline_modulo(*seed);
+        uint32_t i = (uint32_t) *seed
+                     & (LEHMER_ZIGGURAT_EXPONENTIAL_LAYERS - 1);
+        double x = lehmer_ziggurat_uniform(seed)
+                   * lehmer_ziggurat_exponential_x[i];
+
+        // Layer 1 always wedge-tests; x[0] is the base pseudo width
+        if (1 < i && x < lehmer_ziggurat_exponential_x[i - 1]) {
+            return x;
+        }
+
+        if (0 == i) {
+            if (x < LEHMER_ZIGGURAT_EXPONENTIAL_R) {
+                return x; // Base strip below the tail edge
+            }
+            // Tail: memorylessness restarts the distribution past r
+            return LEHMER_ZIGGURAT_EXPONENTIAL_R
+                   - log(lehmer_ziggurat_uniform(seed));
+        }
+
+        double y = lehmer_ziggurat_exponential_y[i]
+                   + lehmer_ziggurat_uniform(seed)
+                         * (lehmer_ziggurat_exponential_y[i - 1]
+                            - lehmer_ziggurat_exponential_y[i]);
+        if (y < exp(-x)) {
+            return x;
+        }
+    }
+}
+
+// Generate a standard normal variate, advancing the stream in place
+double lehmer_normal(lehmer_state_t* state) {
+    LEHMER_STATS_ADD(state, draws, 1);
+    int32_t seed = lehmer_get_current_seed(state);
+    double value = lehmer_ziggurat_normal(&seed);
+    state->sequence[state->position] = seed;
+
+    return value;
+}
+
+// Generate an exponential variate with mean 1, advancing the stream in place
+double lehmer_exponential(lehmer_state_t* state) {
+    LEHMER_STATS_ADD(state, draws, 1);
+    int32_t seed = lehmer_get_current_seed(state);
+    double value = lehmer_ziggurat_exponential(&seed);
+    state->sequence[state->position] = seed;
+
+    return value;
+}
+
+// Fill a caller-provided buffer with standard normal variates in one call
+void lehmer_normal_fill(lehmer_state_t* state, double* buffer, size_t size) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    // Advance the recurrence in a local variable, as lehmer_seed_fill does
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = lehmer_ziggurat_normal(&seed);
+    }
+
+    // Write the final seed back so per-call draws continue the stream
+    state->sequence[state->position] = seed;
+}
+
+// Fill a caller-provided buffer with exponential variates in one call
+void lehmer_exponential_fill(
+    lehmer_state_t* state, double* buffer, size_t size
+) {
+    if (NULL == buffer || 0 == size) {
+        return;
+    }
+
+    LEHMER_STATS_ADD(state, draws, size);
+
+    int32_t seed = lehmer_get_current_seed(state);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = lehmer_ziggurat_exponential(&seed);
+    }
+
+    state->sequence[state->position] = seed;
+}
+
+// Lehmer instrumentation reporting
+
+#ifdef LEHMER_ENABLE_STATS
+// Toggle counter updates at runtime
+void lehmer_stats_toggle(bool enabled) {
+    lehmer_stats_enabled = enabled;
+}
+
+// Print per-state counters and their totals to standard error
+void lehmer_stats_report(lehmer_state_t* const* states, uint32_t count) {
+    if (NULL == states) {
+        LOG_ERROR("Stats report requires an array of states.\n");
+        return;
+    }
+
+    lehmer_stats_t total = {0};
+    for (uint32_t i = 0; i < count; i++) {
+        const lehmer_stats_t* stats = &states[i]->stats;
+
+        fprintf(
+            stderr,
+            "state %u: draws %lu, regenerations %lu, wraps %lu\n",
+            i,
+            stats->draws,
+            stats->regenerations,
+            stats->wraps
+        );
+
+        total.draws += stats->draws;
+        total.regenerations += stats->regenerations;
+        total.wraps += stats->wraps;
     }
 
-    return count;
+    fprintf(
+        stderr,
+        "total: draws %lu, regenerations %lu, wraps %lu\n",
+        total.draws,
+        total.regenerations,
+        total.wraps
+    );
 }
+#endif // LEHMER_ENABLE_STATS
@@ -12,6 +12,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
 int32_t prime_modular_exponent(int32_t a, int32_t b, uint32_t m) {
     int32_t result = 1;
@@ -28,6 +29,70 @@ int32_t prime_modular_exponent(int32_t a, int32_t b, uint32_t m) {
     return result;
 }
 
+// Montgomery reduction: REDC(t) = t * R^-1 mod m with R = 2^32
+static uint32_t prime_montgomery_reduce(
+    const prime_modexp_ctx_t* ctx, uint64_t t
+) {
+    // q = (t mod R) * (-m^-1) mod R
+    uint32_t q = (uint32_t) t * ctx->inverse;
+    // t + q * m is a 65-bit sum for moduli near 2^32; propagate the
+    // carry out of 64 bits explicitly or large moduli reduce wrongly
+    uint64_t sum = t + (uint64_t) q * ctx->modulus;
+    uint64_t carry = (sum < t) ? 1 : 0;
+    // (t + q * m) / R is below 2m, so one conditional subtract suffices
+    uint64_t reduced = (sum >> 32) + (carry << 32);
+    if (reduced >= ctx->modulus) {
+        reduced -= ctx->modulus;
+    }
+    return (uint32_t) reduced;
+}
+
+// Multiply two values already in Montgomery form
+static uint32_t prime_montgomery_multiply(
+    const prime_modexp_ctx_t* ctx, uint32_t x, uint32_t y
+) {
+    return prime_montgomery_reduce(ctx, (uint64_t) x * y);
+}
+
+bool prime_modexp_ctx_init(prime_modexp_ctx_t* ctx, uint32_t m) {
+    if (0 == (m & 1) || 1 >= m) {
+        LOG_ERROR("Montgomery reduction requires an odd modulus > 1.\n");
+        return false;
+    }
+
+    ctx->modulus = m;
+
+    // Newton iteration doubles correct bits each round: 5 rounds cover 32
+    uint32_t inverse = m;
+    for (uint32_t i = 0; i < 5; i++) {
+        inverse *= 2 - m * inverse;
+    }
+    ctx->inverse = (uint32_t) (0 - inverse); // -m^-1 mod 2^32
+
+    // R^2 mod m, computed as (R mod m)^2 mod m in 64-bit
+    uint64_t r = (1ULL << 32) % m;
+    ctx->r2 = (uint32_t) ((r * r) % m);
+
+    return true;
+}
+
+uint32_t prime_modexp(const prime_modexp_ctx_t* ctx, uint32_t a, uint32_t b) {
+    // Enter Montgomery form: a * R mod m and 1 * R mod m
+    uint32_t base = prime_montgomery_multiply(ctx, a % ctx->modulus, ctx->r2);
+    uint32_t result = prime_montgomery_reduce(ctx, ctx->r2); // R mod m
+
+    while (0 < b) {
+        if (b & 1) {
+            result = prime_montgomery_multiply(ctx, result, base);
+        }
+        b >>= 1; // Right-shift b by 1 (dividing by 2)
+        base = prime_montgomery_multiply(ctx, base, base);
+    }
+
+    // Leave Montgomery form: result * R^-1 mod m
+    return prime_montgomery_reduce(ctx, result);
+}
+
 bool prime_miller_rabin(lehmer_state_t* state, uint32_t n, uint16_t k) {
     if (n <= 1 || (n > 2 && n % 2 == 0)) {
         return false; // Handle non-prime edge cases
@@ -74,43 +139,297 @@ bool prime_miller_rabin(lehmer_state_t* state, uint32_t n, uint16_t k) {
     return true;
 }
 
+// Bitset helpers for the sieve: one bit per candidate, 32 per word
+
+static inline void prime_sieve_mark(uint32_t* bitset, uint32_t n) {
+    bitset[n >> 5] |= (1U << (n & 31));
+}
+
+static inline bool prime_sieve_is_marked(const uint32_t* bitset, uint32_t n) {
+    return (bitset[n >> 5] >> (n & 31)) & 1;
+}
+
+// Compute a^d mod n with 64-bit intermediates (no overflow for 32-bit n)
+static uint32_t prime_power_mod(uint32_t a, uint32_t d, uint32_t n) {
+    uint64_t result = 1;
+    uint64_t base = a % n;
+
+    while (0 < d) {
+        if (d & 1) {
+            result = (result * base) % n;
+        }
+        d >>= 1; // Right-shift d by 1 (dividing by 2)
+        base = (base * base) % n; // Square base and reduce modulo n
+    }
+
+    return (uint32_t) result;
+}
+
+// Check whether witness a proves n composite, given n - 1 = d * 2^s
+static bool prime_witness_composite(
+    uint32_t a, uint32_t d, uint32_t s, uint32_t n
+) {
+    uint64_t x = prime_power_mod(a, d, n);
+    if (1 == x || n - 1 == x) {
+        return false; // Inconclusive: n may be prime
+    }
+
+    for (uint32_t r = 1; r < s; r++) {
+        x = (x * x) % n; // 64-bit squaring; safe for any 32-bit n
+        if (n - 1 == x) {
+            return false; // Inconclusive: n may be prime
+        }
+    }
+
+    return true; // Definitely composite
+}
+
+bool prime_miller_rabin_deterministic(uint32_t n) {
+    if (n <= 1) {
+        return false;
+    }
+    if (n <= 3) {
+        return true;
+    }
+    if (0 == n % 2) {
+        return false;
+    }
+
+    // Decompose n - 1 = d * 2^s with d odd
+    uint32_t d = n - 1;
+    uint32_t s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1; // Remove factors of 2
+        s++;
+    }
+
+    // The witness set {2, 7, 61} is exact for every n below 4,759,123,141
+    const uint32_t witnesses[] = {2, 7, 61};
+    for (size_t i = 0; i < 3; i++) {
+        uint32_t a = witnesses[i] % n;
+        if (0 == a) {
+            continue; // n divides the witness; only possible for tiny n
+        }
+        if (prime_witness_composite(a, d, s, n)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void prime_miller_rabin_batch(
+    const uint32_t* candidates, size_t size, uint8_t* out
+) {
+    if (NULL == candidates || NULL == out) {
+        LOG_ERROR("Batch candidates and output must not be NULL.\n");
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        out[i] = prime_miller_rabin_deterministic(candidates[i]) ? 1 : 0;
+    }
+}
+
 prime_sample_t* prime_sample_create(uint32_t size) {
     if (2 > size) {
         LOG_ERROR("Prime number sample size must be greater than 2.\n");
         return NULL;
     }
 
+    // Sieve of Eratosthenes over [2, size] with bitset storage: one bit per
+    // candidate instead of a trial division per candidate
+    uint32_t words = (size >> 5) + 1;
+    uint32_t* composite = (uint32_t*) calloc(words, sizeof(uint32_t));
+    if (NULL == composite) {
+        LOG_ERROR("Failed to allocate memory to prime sieve bitset.\n");
+        return NULL;
+    }
+
+    // Mark every multiple of each surviving candidate as composite
+    for (uint32_t i = 2; (uint64_t) i * i <= size; i++) {
+        if (prime_sieve_is_marked(composite, i)) {
+            continue;
+        }
+        for (uint64_t j = (uint64_t) i * i; j <= size; j += i) {
+            prime_sieve_mark(composite, (uint32_t) j);
+        }
+    }
+
+    // Count the survivors so the sample is allocated exactly once
+    uint32_t count = 0;
+    for (uint32_t i = 2; i <= size; i++) {
+        if (!prime_sieve_is_marked(composite, i)) {
+            count++;
+        }
+    }
+
     // Allocate memory for sampling
     prime_sample_t* sample = (prime_sample_t*) malloc(sizeof(prime_sample_t));
+    if (NULL == sample) {
+        LOG_ERROR("Failed to allocate memory to prime sample.\n");
+        free(composite);
+        return NULL;
+    }
+
     // Allocate memory for number of sampled data points
-    sample->data = malloc(size * sizeof(int16_t));
+    sample->data = (int32_t*) malloc(count * sizeof(int32_t));
+    if (NULL == sample->data) {
+        LOG_ERROR("Failed to allocate memory to prime sample data.\n");
+        free(composite);
+        free(sample);
+        return NULL;
+    }
 
+    // Collect the primes from the bitset
     uint32_t j = 0;
+    for (uint32_t i = 2; i <= size; i++) {
+        if (!prime_sieve_is_marked(composite, i)) {
+            sample->data[j++] = (int32_t) i;
+        }
+    }
+    sample->size = j;
+
+    free(composite);
 
-    // Handle the first prime (2) directly.
-    sample->data[j++] = 2;
+    return sample;
+}
 
-    // Generate primes starting from 3
-    for (uint32_t i = 3; i <= size; i += 2) {
-        bool is_prime = true;
+prime_iter_t* prime_iter_create(uint32_t limit) {
+    if (2 > limit) {
+        LOG_ERROR("Prime iterator limit must be greater than 1.\n");
+        return NULL;
+    }
 
-        for (uint32_t divisor = 3; divisor * divisor <= i; divisor += 2) {
-            if (i % divisor == 0) {
-                is_prime = false;
-                break;
-            }
+    prime_iter_t* iter = (prime_iter_t*) malloc(sizeof(prime_iter_t));
+    if (NULL == iter) {
+        LOG_ERROR("Failed to allocate memory to prime iterator.\n");
+        return NULL;
+    }
+
+    iter->low = 2;
+    iter->limit = limit;
+    iter->base = NULL;
+    iter->base_count = 0;
+
+    // Base primes up to sqrt(limit) cross off every composite in any
+    // segment; at most 65536 candidates, so the one-shot sieve is cheap
+    uint32_t root = 2;
+    while ((uint64_t) (root + 1) * (root + 1) <= limit) {
+        root++;
+    }
+
+    if (4 <= limit) {
+        prime_sample_t* sample = prime_sample_create(root);
+        if (NULL == sample) {
+            free(iter);
+            return NULL;
         }
+        // Take ownership of the base table; only the wrapper is released
+        iter->base = sample->data;
+        iter->base_count = sample->size;
+        free(sample);
+    }
+
+    // One bit per candidate in the segment, 32 per word
+    uint32_t words = (PRIME_ITER_SEGMENT >> 5) + 1;
+    iter->composite = (uint32_t*) malloc(words * sizeof(uint32_t));
+    if (NULL == iter->composite) {
+        LOG_ERROR("Failed to allocate memory to prime segment bitset.\n");
+        free(iter->base);
+        free(iter);
+        return NULL;
+    }
 
-        if (is_prime) {
-            sample->data[j++] = i;
+    // Every prime above 2 is odd, so half the segment width plus the
+    // even prime itself bounds any batch
+    iter->batch
+        = (int32_t*) malloc((PRIME_ITER_SEGMENT / 2 + 1) * sizeof(int32_t));
+    if (NULL == iter->batch) {
+        LOG_ERROR("Failed to allocate memory to prime segment batch.\n");
+        free(iter->composite);
+        free(iter->base);
+        free(iter);
+        return NULL;
+    }
+
+    return iter;
+}
+
+bool prime_iter_next_segment(
+    prime_iter_t* iter, int32_t** out, uint32_t* count
+) {
+    if (NULL == iter || NULL == out || NULL == count) {
+        LOG_ERROR("Prime iterator arguments must not be NULL.\n");
+        return false;
+    }
+
+    if (iter->low > iter->limit) {
+        *out = NULL;
+        *count = 0;
+        return false; // The range is exhausted
+    }
+
+    // 64-bit cursor: low never wraps, even for limits near UINT32_MAX
+    uint32_t low = (uint32_t) iter->low;
+    uint32_t high = iter->limit - low < PRIME_ITER_SEGMENT - 1
+                        ? iter->limit
+                        : low + PRIME_ITER_SEGMENT - 1;
+
+    // Reset the segment bitset; offsets are relative to low
+    uint32_t words = ((high - low) >> 5) + 1;
+    memset(iter->composite, 0, words * sizeof(uint32_t));
+
+    // Cross off each base prime's multiples inside [low, high]
+    for (uint32_t i = 0; i < iter->base_count; i++) {
+        uint64_t p = (uint64_t) iter->base[i];
+        if (p * p > high) {
+            break; // Larger base primes have no multiples in this window
+        }
+
+        // First multiple in range: p^2, or p rounded up past low
+        uint64_t start = p * p;
+        if (start < low) {
+            start = ((low + p - 1) / p) * p;
+        }
+
+        for (uint64_t j = start; j <= high; j += p) {
+            prime_sieve_mark(iter->composite, (uint32_t) (j - low));
         }
     }
 
-    // Resize array to actual number of primes found
-    sample->data = realloc(sample->data, j * sizeof(int16_t));
-    sample->size = j;
+    // Collect the survivors into the reusable batch
+    uint32_t j = 0;
+    for (uint32_t i = low; i <= high; i++) {
+        if (!prime_sieve_is_marked(iter->composite, i - low)) {
+            iter->batch[j++] = (int32_t) i;
+        }
+    }
 
-    return sample;
+    *out = iter->batch;
+    *count = j;
+    iter->low = (uint64_t) high + 1;
+
+    return true;
+}
+
+void prime_iter_free(prime_iter_t* iter) {
+    if (NULL == iter) {
+        LOG_ERROR("Prime iterator is NULL.\n");
+        return;
+    }
+
+    if (iter->batch) {
+        free(iter->batch);
+    }
+    if (iter->composite) {
+        free(iter->composite);
+    }
+    if (iter->base) {
+        free(iter->base);
+    }
+
+    free(iter);
 }
 
 void prime_sample_free(prime_sample_t* sample) {
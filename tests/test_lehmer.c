@@ -11,12 +11,15 @@
 
 #include "float_is_close.h"
 #include "lehmer.h"
+#include "lehmer_inline.h"
 #include "logger.h"
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 
 /**
  * @param LEHMER_CHECK_JUMP Used in testing for validation
@@ -230,6 +233,17 @@ int test_lehmer_seed_normalize(void) {
         passed = false;
     }
 
+    // negative residues (e.g. Schrage's gamma) map back into [0, m - 1]
+    if (LEHMER_MODULUS - 1 != lehmer_seed_normalize_to_int(-1)) {
+        LOG_ERROR(
+            "Failed: expected -1 to normalize to %lu, but got %lu",
+            LEHMER_MODULUS - 1,
+            lehmer_seed_normalize_to_int(-1)
+        );
+        lehmer_state_print(state);
+        passed = false;
+    }
+
     expected_float = 0.053803154f;
     current_float = lehmer_seed_normalize_to_float(current_seed);
     if (!float_is_close(expected_float, current_float, 7)) {
@@ -386,6 +400,1194 @@ int test_jump_state(void) {
     return passed ? 0 : 1;
 }
 
+int test_lehmer_state_lazy(void) {
+    bool passed = true;
+
+    lehmer_state_t* state = lehmer_state_create_lazy(LEHMER_SEED, LEHMER_SIZE);
+
+    // Test: construction materializes nothing
+    if (0 != state->filled) {
+        LOG_ERROR(
+            "test_lehmer_state_lazy: Expected state->filled = 0, "
+            "but got %u\n",
+            state->filled
+        );
+        passed = false;
+    }
+
+    // Test: lazy draws match the eager sequence exactly
+    lehmer_state_t* expected_state = setup_lehmer_state();
+    for (uint32_t i = 0; i < 32; i++) {
+        int32_t expected_seed = lehmer_get_current_seed(expected_state);
+        int32_t current_seed = lehmer_get_current_seed(state);
+
+        if (expected_seed != current_seed) {
+            LOG_ERROR(
+                "test_lehmer_state_lazy: Expected seed %d at position %u, "
+                "but got %d\n",
+                expected_seed,
+                i,
+                current_seed
+            );
+            passed = false;
+            break;
+        }
+
+        lehmer_set_next_seed(expected_state);
+        lehmer_set_next_seed(state);
+    }
+
+    // Test: only the touched prefix was materialized
+    if (32 != state->filled) {
+        LOG_ERROR(
+            "test_lehmer_state_lazy: Expected state->filled = 32, "
+            "but got %u\n",
+            state->filled
+        );
+        passed = false;
+    }
+
+    teardown_lehmer_state(expected_state);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_random_bounded(void) {
+    bool passed = true;
+    const uint32_t range = 6;
+    const uint32_t draws = 60000;
+    uint32_t counts[6] = {0};
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    // Test: per-call values stay within 0, ..., range - 1
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint32_t value = lehmer_random_bounded(state, range);
+        if (range <= value) {
+            LOG_ERROR(
+                "test_lehmer_random_bounded: Expected value < %u, "
+                "but got %u\n",
+                range,
+                value
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    // Histogram the batch fill, which walks the raw recurrence
+    uint32_t* buffer = (uint32_t*) malloc(draws * sizeof(uint32_t));
+    lehmer_random_bounded_fill(state, range, buffer, draws);
+    for (uint32_t i = 0; i < draws; i++) {
+        if (range <= buffer[i]) {
+            LOG_ERROR(
+                "test_lehmer_random_bounded: Expected value < %u, "
+                "but got %u\n",
+                range,
+                buffer[i]
+            );
+            passed = false;
+            break;
+        }
+        counts[buffer[i]]++;
+    }
+    free(buffer);
+
+    // Test: each bucket lands near draws / range (within 5%)
+    for (uint32_t i = 0; passed && i < range; i++) {
+        uint32_t expected_count = draws / range;
+        uint32_t tolerance = expected_count / 20;
+        if (counts[i] < expected_count - tolerance
+            || counts[i] > expected_count + tolerance) {
+            LOG_ERROR(
+                "test_lehmer_random_bounded: Expected counts[%u] near %u, "
+                "but got %u\n",
+                i,
+                expected_count,
+                counts[i]
+            );
+            passed = false;
+        }
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_state_snapshot(void) {
+    bool passed = true;
+
+    lehmer_state_t* state = setup_lehmer_state();
+    lehmer_set_next_seed(state); // give the snapshot a non-zero position
+
+    // save the state into an unlinked temporary file
+    FILE* file = tmpfile();
+    if (NULL == file) {
+        LOG_ERROR("test_lehmer_state_snapshot: Failed to open tmpfile\n");
+        teardown_lehmer_state(state);
+        return 1;
+    }
+
+    if (!lehmer_state_save(state, fileno(file))) {
+        LOG_ERROR("test_lehmer_state_snapshot: Failed to save snapshot\n");
+        passed = false;
+    }
+
+    // map the snapshot back and use it in place
+    size_t size = sizeof(lehmer_snapshot_header_t)
+                  + sizeof(int32_t) * state->length;
+    void* addr
+        = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    if (MAP_FAILED == addr) {
+        LOG_ERROR("test_lehmer_state_snapshot: Failed to map snapshot\n");
+        teardown_lehmer_state(state);
+        fclose(file);
+        return 1;
+    }
+
+    lehmer_state_t mapped;
+    if (!lehmer_state_map(&mapped, addr)) {
+        LOG_ERROR("test_lehmer_state_snapshot: Failed to adopt snapshot\n");
+        passed = false;
+    }
+
+    // the mapped state must mirror the saved one with zero deserialization
+    if (passed
+        && (mapped.seed != state->seed || mapped.length != state->length
+            || mapped.position != state->position
+            || lehmer_get_current_seed(&mapped)
+                   != lehmer_get_current_seed(state))) {
+        LOG_ERROR("test_lehmer_state_snapshot: Mapped state mismatch\n");
+        lehmer_state_print(&mapped);
+        lehmer_state_print(state);
+        passed = false;
+    }
+
+    munmap(addr, size);
+
+    // corrupt headers must be rejected, not adopted
+    lehmer_snapshot_header_t corrupt = {
+        .magic = LEHMER_SNAPSHOT_MAGIC,
+        .version = LEHMER_SNAPSHOT_VERSION,
+        .seed = LEHMER_SEED,
+        .length = 0,
+        .position = 0,
+    };
+    if (lehmer_state_map(&mapped, &corrupt)) {
+        LOG_ERROR("test_lehmer_state_snapshot: Accepted zero length\n");
+        passed = false;
+    }
+    corrupt.length = LEHMER_SIZE;
+    corrupt.position = LEHMER_SIZE; // one past the last valid slot
+    if (lehmer_state_map(&mapped, &corrupt)) {
+        LOG_ERROR("test_lehmer_state_snapshot: Accepted out-of-range "
+                  "position\n");
+        passed = false;
+    }
+
+    fclose(file);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_seed_normalize_to_double(void) {
+    bool passed = true;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    // the double path must agree with the float path and keep all 31 bits
+    int32_t seed = lehmer_get_current_seed(state);
+    double current_output = lehmer_seed_normalize_to_double(seed);
+    double expected_output = (double) seed / (double) LEHMER_MODULUS;
+
+    if (!double_is_close(expected_output, current_output, 15)) {
+        LOG_ERROR(
+            "test_lehmer_seed_normalize_to_double: Expected %.15f, "
+            "but got %.15f\n",
+            expected_output,
+            current_output
+        );
+        passed = false;
+    }
+
+    // the double draw must track the float draw on the same stream
+    lehmer_state_t* expected_state = setup_lehmer_state();
+    float expected_float = lehmer_random_modulo(expected_state);
+    double current_double = lehmer_random_modulo_d(state);
+
+    if (!float_is_close(expected_float, (float) current_double, 7)) {
+        LOG_ERROR(
+            "test_lehmer_seed_normalize_to_double: Expected draw %.7f, "
+            "but got %.7f\n",
+            expected_float,
+            (float) current_double
+        );
+        passed = false;
+    }
+
+    teardown_lehmer_state(expected_state);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_stream_pool(void) {
+    bool passed = true;
+    const uint32_t count = 4;
+    const uint64_t stride = 1000;
+
+    lehmer_stream_pool_t* pool
+        = lehmer_stream_pool_create(count, LEHMER_SEED, LEHMER_SIZE, stride);
+
+    // stream i must match stream 0 jumped ahead by i * stride steps
+    for (uint32_t i = 1; i < count; i++) {
+        lehmer_state_t* expected_state = setup_lehmer_state();
+        lehmer_state_jump(expected_state, (uint64_t) i * stride);
+
+        lehmer_state_t* stream = lehmer_stream_pool_get(pool, i);
+        int32_t expected_seed = lehmer_get_initial_seed(expected_state);
+        int32_t current_seed = lehmer_get_initial_seed(stream);
+
+        if (expected_seed != current_seed) {
+            LOG_ERROR(
+                "test_lehmer_stream_pool: Expected stream %u seed %d, "
+                "but got %d\n",
+                i,
+                expected_seed,
+                current_seed
+            );
+            passed = false;
+        }
+
+        teardown_lehmer_state(expected_state);
+    }
+
+    // out-of-range indices yield NULL
+    if (NULL != lehmer_stream_pool_get(pool, count)) {
+        LOG_ERROR(
+            "test_lehmer_stream_pool: Expected NULL for index %u\n", count
+        );
+        passed = false;
+    }
+
+    lehmer_stream_pool_free(pool);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_bank(void) {
+    bool passed = true;
+    const uint32_t count = 8;
+    const uint32_t steps = 3;
+
+    lehmer_bank_t* bank = lehmer_bank_create(LEHMER_SEED, count);
+    float out[8] = {0.0f};
+
+    for (uint32_t step = 1; step <= steps; step++) {
+        lehmer_bank_step_all(bank, out);
+
+        // every lane matches the stateless reference for its sub-stream
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t expected_seed
+                = lehmer_at(LEHMER_SEED, (uint64_t) i * LEHMER_STRIDE + step);
+
+            if (expected_seed != bank->seeds[i]) {
+                LOG_ERROR(
+                    "test_lehmer_bank: Expected lane %u seed %d at step %u, "
+                    "but got %d\n",
+                    i,
+                    expected_seed,
+                    step,
+                    bank->seeds[i]
+                );
+                passed = false;
+            }
+
+            float expected_float
+                = lehmer_seed_normalize_to_float(expected_seed);
+            if (!float_is_close(expected_float, out[i], 7)) {
+                LOG_ERROR(
+                    "test_lehmer_bank: Expected lane %u draw %.7f at step "
+                    "%u, but got %.7f\n",
+                    i,
+                    expected_float,
+                    step,
+                    out[i]
+                );
+                passed = false;
+            }
+        }
+    }
+
+    lehmer_bank_free(bank);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_stream_to_fd(void) {
+    bool passed = true;
+
+    // cross several ping-pong swaps, plus a trailing odd byte to trim
+    const size_t count = 3 * (LEHMER_STREAM_BUFFER / sizeof(float)) + 100;
+    const size_t n_bytes = count * sizeof(float) + 1;
+
+    lehmer_state_t* state = setup_lehmer_state();
+    int32_t expected_seed = lehmer_get_current_seed(state);
+
+    FILE* file = tmpfile();
+    if (NULL == file) {
+        LOG_ERROR("test_lehmer_stream_to_fd: Failed to create temp file\n");
+        teardown_lehmer_state(state);
+        return 1;
+    }
+
+    if (!lehmer_stream_to_fd(
+            state, lehmer_generate_modulo, fileno(file), n_bytes
+        )) {
+        LOG_ERROR("test_lehmer_stream_to_fd: Failed to stream variates\n");
+        fclose(file);
+        teardown_lehmer_state(state);
+        return 1;
+    }
+
+    // the byte count is rounded down to whole floats
+    fseek(file, 0, SEEK_END);
+    size_t written = (size_t) ftell(file);
+    if (count * sizeof(float) != written) {
+        LOG_ERROR(
+            "test_lehmer_stream_to_fd: Expected %zu bytes, but got %zu\n",
+            count * sizeof(float),
+            written
+        );
+        passed = false;
+    }
+
+    // the streamed floats replay the recurrence exactly
+    rewind(file);
+    for (size_t i = 0; i < count && passed; i++) {
+        float current = 0.0f;
+        if (1 != fread(&current, sizeof(float), 1, file)) {
+            LOG_ERROR(
+                "test_lehmer_stream_to_fd: Failed to read float %zu\n", i
+            );
+            passed = false;
+            break;
+        }
+
+        expected_seed = lehmer_generate_modulo(expected_seed);
+        float expected = lehmer_seed_normalize_to_float(expected_seed);
+        if (!float_is_close(expected, current, 7)) {
+            LOG_ERROR(
+                "test_lehmer_stream_to_fd: Expected float %zu = %.7f, "
+                "but got %.7f\n",
+                i,
+                expected,
+                current
+            );
+            passed = false;
+        }
+    }
+
+    // per-call draws continue the stream after the final streamed value
+    if (expected_seed != lehmer_get_current_seed(state)) {
+        LOG_ERROR(
+            "test_lehmer_stream_to_fd: Expected final seed %d, but got %d\n",
+            expected_seed,
+            lehmer_get_current_seed(state)
+        );
+        passed = false;
+    }
+
+    fclose(file);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_shuffle(void) {
+    bool passed = true;
+    const size_t n = 100;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    int32_t values[100];
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int32_t) i;
+    }
+
+    lehmer_shuffle(state, values, n, sizeof(int32_t));
+
+    // every original element appears exactly once
+    bool seen[100] = {false};
+    for (size_t i = 0; i < n; i++) {
+        if (0 > values[i] || (int32_t) n <= values[i] || seen[values[i]]) {
+            LOG_ERROR(
+                "test_lehmer_shuffle: Expected a permutation, but values[%zu] "
+                "= %d breaks it\n",
+                i,
+                values[i]
+            );
+            passed = false;
+            break;
+        }
+        seen[values[i]] = true;
+    }
+
+    // a 100-element identity permutation surviving a shuffle is absurd
+    size_t moved = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (values[i] != (int32_t) i) {
+            moved++;
+        }
+    }
+    if (0 == moved) {
+        LOG_ERROR("test_lehmer_shuffle: Expected elements to move\n");
+        passed = false;
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_sample_k(void) {
+    bool passed = true;
+    const uint32_t n = 100;
+    const uint32_t k = 10;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    uint32_t out[10] = {0};
+    lehmer_sample_k(state, n, k, out);
+
+    // indices are strictly increasing, which also makes them distinct
+    for (uint32_t i = 0; i < k; i++) {
+        if (n <= out[i] || (0 < i && out[i - 1] >= out[i])) {
+            LOG_ERROR(
+                "test_lehmer_sample_k: Expected strictly increasing indices "
+                "below %u, but got out[%u] = %u\n",
+                n,
+                i,
+                out[i]
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_next(void) {
+    bool passed = true;
+    const uint32_t steps = 100;
+
+    // the inline fast path replays the library recurrence exactly
+    int32_t seed = LEHMER_SEED;
+    int32_t expected_seed = LEHMER_SEED;
+    for (uint32_t i = 0; i < steps; i++) {
+        expected_seed = lehmer_generate_modulo(expected_seed);
+
+        int32_t current_seed = lehmer_next(&seed);
+        if (expected_seed != current_seed || expected_seed != seed) {
+            LOG_ERROR(
+                "test_lehmer_next: Expected seed %d at step %u, "
+                "but got %d\n",
+                expected_seed,
+                i,
+                current_seed
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    // the normalizing variants advance and scale in one shot
+    int32_t float_seed = LEHMER_SEED;
+    float expected_float
+        = lehmer_seed_normalize_to_float(lehmer_generate_modulo(LEHMER_SEED));
+    if (!float_is_close(expected_float, lehmer_next_float(&float_seed), 7)) {
+        LOG_ERROR("test_lehmer_next: Expected %.7f from lehmer_next_float\n",
+                  expected_float);
+        passed = false;
+    }
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_generate_stream(void) {
+    bool passed = true;
+
+    // a sequence past LEHMER_CACHE_BUDGET takes the non-temporal path
+    const uint32_t length = LEHMER_CACHE_BUDGET / sizeof(int32_t) + 1024;
+    lehmer_state_t* state = lehmer_state_create(LEHMER_SEED, length);
+
+    // the streamed lane kernel must match the serial recurrence exactly
+    int32_t expected_seed = LEHMER_SEED;
+    for (uint32_t i = 0; i < length; i++) {
+        expected_seed = lehmer_generate_modulo(expected_seed);
+        if (expected_seed != state->sequence[i]) {
+            LOG_ERROR(
+                "test_lehmer_generate_stream: Expected seed %d at index %u, "
+                "but got %d\n",
+                expected_seed,
+                i,
+                state->sequence[i]
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    // the generic generator path streams too
+    lehmer_generate(state, lehmer_generate_gamma, LEHMER_SEED);
+    expected_seed = lehmer_generate_gamma(LEHMER_SEED);
+    for (uint32_t i = 0; i < length; i++) {
+        if (expected_seed != state->sequence[i]) {
+            LOG_ERROR(
+                "test_lehmer_generate_stream: Expected gamma seed %d at "
+                "index %u, but got %d\n",
+                expected_seed,
+                i,
+                state->sequence[i]
+            );
+            passed = false;
+            break;
+        }
+        expected_seed = lehmer_generate_gamma(expected_seed % LEHMER_MODULUS);
+    }
+
+    lehmer_state_free(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_replay(void) {
+    bool passed = true;
+    const uint32_t steps = 1000;
+    const uint32_t stream = 3;
+
+    // a worker records only its origin, stream id, and draw count
+    lehmer_record_t record;
+    lehmer_record_init(&record, LEHMER_SEED, stream);
+
+    // replay the forward path by hand, logging a few checkpoints
+    int32_t seed
+        = lehmer_at(LEHMER_SEED, (uint64_t) stream * LEHMER_STRIDE);
+    int32_t at_100 = 0;
+    for (uint32_t i = 0; i < steps; i++) {
+        seed = lehmer_generate_modulo(seed);
+        record.draws++;
+        if (100 == record.draws) {
+            at_100 = seed;
+        }
+    }
+
+    // draw 0 is the stream's initial seed
+    int32_t expected_start
+        = lehmer_at(LEHMER_SEED, (uint64_t) stream * LEHMER_STRIDE);
+    if (expected_start != lehmer_replay_seek(&record, 0)) {
+        LOG_ERROR("test_lehmer_replay: Expected draw 0 to be the stream "
+                  "start\n");
+        passed = false;
+    }
+
+    // random access into the middle of the stream
+    if (at_100 != lehmer_replay_seek(&record, 100)) {
+        LOG_ERROR(
+            "test_lehmer_replay: Expected seed %d at draw 100, but got %d\n",
+            at_100,
+            lehmer_replay_seek(&record, 100)
+        );
+        passed = false;
+    }
+
+    // opening the record resumes exactly where the worker stopped
+    if (seed != lehmer_replay_open(&record)) {
+        LOG_ERROR(
+            "test_lehmer_replay: Expected seed %d after %lu draws, "
+            "but got %d\n",
+            seed,
+            record.draws,
+            lehmer_replay_open(&record)
+        );
+        passed = false;
+    }
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_position_ring(void) {
+    bool passed = true;
+
+    // the default length is a power of two, so the mask must be armed
+    lehmer_state_t* state = setup_lehmer_state();
+    if (LEHMER_SIZE - 1 != state->mask) {
+        LOG_ERROR(
+            "test_lehmer_position_ring: Expected mask %u, but got %u\n",
+            (uint32_t) LEHMER_SIZE - 1,
+            state->mask
+        );
+        passed = false;
+    }
+
+    // stepping backwards from position 0 wraps to the last entry
+    lehmer_set_previous_seed(state);
+    if (LEHMER_SIZE - 1 != state->position) {
+        LOG_ERROR(
+            "test_lehmer_position_ring: Expected position %u, but got %lu\n",
+            (uint32_t) LEHMER_SIZE - 1,
+            state->position
+        );
+        passed = false;
+    }
+    lehmer_set_next_seed(state);
+    if (0 != state->position) {
+        LOG_ERROR(
+            "test_lehmer_position_ring: Expected position 0, but got %lu\n",
+            state->position
+        );
+        passed = false;
+    }
+    teardown_lehmer_state(state);
+
+    // a non-power-of-two length falls back to the modulo ring
+    state = lehmer_state_create(LEHMER_SEED, 10);
+    if (0 != state->mask) {
+        LOG_ERROR(
+            "test_lehmer_position_ring: Expected mask 0 for length 10, "
+            "but got %u\n",
+            state->mask
+        );
+        passed = false;
+    }
+
+    // the backward wrap must land on length - 1, not on the unsigned
+    // underflow of (position - 1) % length
+    lehmer_set_previous_seed(state);
+    if (9 != state->position) {
+        LOG_ERROR(
+            "test_lehmer_position_ring: Expected position 9, but got %lu\n",
+            state->position
+        );
+        passed = false;
+    }
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+#ifdef LEHMER_ENABLE_STATS
+int test_lehmer_stats(void) {
+    bool passed = true;
+    const uint32_t draws = 10;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    // counters start at zero and track the per-call draw path
+    for (uint32_t i = 0; i < draws; i++) {
+        lehmer_random_modulo(state);
+    }
+    if (draws != state->stats.draws) {
+        LOG_ERROR(
+            "test_lehmer_stats: Expected %u draws, but got %lu\n",
+            draws,
+            state->stats.draws
+        );
+        passed = false;
+    }
+
+    // bulk fills count every value they emit
+    float buffer[32] = {0.0f};
+    lehmer_random_fill(state, buffer, 32);
+    if (draws + 32 != state->stats.draws) {
+        LOG_ERROR(
+            "test_lehmer_stats: Expected %u draws after fill, but got %lu\n",
+            draws + 32,
+            state->stats.draws
+        );
+        passed = false;
+    }
+
+    // variate and sampling paths count their emitted values too
+    double variates[8] = {0.0};
+    lehmer_normal_fill(state, variates, 8);
+    uint32_t sampled[4] = {0};
+    lehmer_sample_k(state, 100, 4, sampled);
+    if (draws + 32 + 8 + 4 != state->stats.draws) {
+        LOG_ERROR(
+            "test_lehmer_stats: Expected %u draws after variates, "
+            "but got %lu\n",
+            draws + 32 + 8 + 4,
+            state->stats.draws
+        );
+        passed = false;
+    }
+
+    // regenerations are attributed to the state that triggered them
+    lehmer_regenerate(state, lehmer_generate_modulo);
+    if (1 != state->stats.regenerations) {
+        LOG_ERROR(
+            "test_lehmer_stats: Expected 1 regeneration, but got %lu\n",
+            state->stats.regenerations
+        );
+        passed = false;
+    }
+
+    // the runtime toggle freezes the counters without recompiling;
+    // note lehmer_regenerate() consumed one draw selecting its seed
+    uint64_t frozen = state->stats.draws;
+    lehmer_stats_toggle(false);
+    lehmer_random_modulo(state);
+    lehmer_stats_toggle(true);
+    if (frozen != state->stats.draws) {
+        LOG_ERROR(
+            "test_lehmer_stats: Expected the toggle to freeze draws at %lu, "
+            "but got %lu\n",
+            frozen,
+            state->stats.draws
+        );
+        passed = false;
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+#endif // LEHMER_ENABLE_STATS
+
+int test_lehmer_binomial(void) {
+    bool passed = true;
+    const uint32_t n = 10;
+    const float p = 0.5f;
+    const uint32_t draws = 10000;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < draws; i++) {
+        int32_t outcome = lehmer_binomial(state, n, p);
+
+        // Test: outcomes stay within 0, ..., n
+        if (0 > outcome || (int32_t) n < outcome) {
+            LOG_ERROR(
+                "test_lehmer_binomial: Expected outcome in [0, %u], "
+                "but got %d\n",
+                n,
+                outcome
+            );
+            passed = false;
+            break;
+        }
+
+        sum += outcome;
+    }
+
+    // Test: the sample mean approaches n * p
+    double mean = sum / draws;
+    if (4.8 > mean || 5.2 < mean) {
+        LOG_ERROR(
+            "test_lehmer_binomial: Expected mean near %.1f, but got %.3f\n",
+            (double) n * p,
+            mean
+        );
+        passed = false;
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_normal_exponential(void) {
+    bool passed = true;
+    const size_t draws = 100000;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    double* buffer = (double*) malloc(draws * sizeof(double));
+    if (NULL == buffer) {
+        LOG_ERROR("test_lehmer_normal_exponential: Failed to allocate\n");
+        teardown_lehmer_state(state);
+        return 1;
+    }
+
+    // Test: normal variates have mean near 0 and variance near 1
+    lehmer_normal_fill(state, buffer, draws);
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    for (size_t i = 0; i < draws; i++) {
+        sum += buffer[i];
+        sum_squares += buffer[i] * buffer[i];
+    }
+    double mean = sum / draws;
+    double variance = sum_squares / draws - mean * mean;
+    if (-0.02 > mean || 0.02 < mean) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected normal mean near 0, "
+            "but got %.4f\n",
+            mean
+        );
+        passed = false;
+    }
+    if (0.97 > variance || 1.03 < variance) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected normal variance near "
+            "1, but got %.4f\n",
+            variance
+        );
+        passed = false;
+    }
+
+    // Test: exponential variates are non-negative with mean near 1
+    lehmer_exponential_fill(state, buffer, draws);
+    sum = 0.0;
+    for (size_t i = 0; i < draws; i++) {
+        if (0.0 > buffer[i]) {
+            LOG_ERROR(
+                "test_lehmer_normal_exponential: Expected non-negative "
+                "variate, but got %.4f\n",
+                buffer[i]
+            );
+            passed = false;
+            break;
+        }
+        sum += buffer[i];
+    }
+    mean = sum / draws;
+    if (0.97 > mean || 1.03 < mean) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected exponential mean near "
+            "1, but got %.4f\n",
+            mean
+        );
+        passed = false;
+    }
+
+    // Test: the CDF at the top ziggurat layer edge; mean and variance
+    // cannot see mass misplaced near 0 when layer 1 skips its wedge test
+    const size_t cdf_draws = 2000000;
+    const double normal_edge = 0.272321; // x[1] of the 128-layer table
+    const double exponential_edge = 0.063852; // x[1] of the 256-layer table
+    double expected_normal = erf(normal_edge / sqrt(2.0));
+    double expected_exponential = 1.0 - exp(-exponential_edge);
+    size_t below_normal = 0;
+    size_t below_exponential = 0;
+    for (size_t chunk = 0; chunk < cdf_draws / draws; chunk++) {
+        lehmer_normal_fill(state, buffer, draws);
+        for (size_t i = 0; i < draws; i++) {
+            if (fabs(buffer[i]) <= normal_edge) {
+                below_normal++;
+            }
+        }
+        lehmer_exponential_fill(state, buffer, draws);
+        for (size_t i = 0; i < draws; i++) {
+            if (buffer[i] <= exponential_edge) {
+                below_exponential++;
+            }
+        }
+    }
+    double cdf = (double) below_normal / cdf_draws;
+    if (fabs(cdf - expected_normal) > 0.0015) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected P(|X| <= %.6f) near "
+            "%.6f, but got %.6f\n",
+            normal_edge,
+            expected_normal,
+            cdf
+        );
+        passed = false;
+    }
+    cdf = (double) below_exponential / cdf_draws;
+    if (fabs(cdf - expected_exponential) > 0.001) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected P(X <= %.6f) near "
+            "%.6f, but got %.6f\n",
+            exponential_edge,
+            expected_exponential,
+            cdf
+        );
+        passed = false;
+    }
+
+    // Test: per-call draws continue the stream without diverging
+    double single = lehmer_normal(state);
+    if (-10.0 > single || 10.0 < single) {
+        LOG_ERROR(
+            "test_lehmer_normal_exponential: Expected a bounded single "
+            "draw, but got %.4f\n",
+            single
+        );
+        passed = false;
+    }
+
+    free(buffer);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_state_init(void) {
+    bool passed = true;
+
+    // caller-owned storage; no heap, no teardown
+    lehmer_state_t state;
+    int32_t sequence[LEHMER_SIZE];
+    lehmer_state_init(&state, sequence, LEHMER_SIZE, LEHMER_SEED);
+
+    // Test: the stack state matches a heap state with the same parameters
+    lehmer_state_t* expected_state = setup_lehmer_state();
+    for (uint32_t i = 0; i < LEHMER_SIZE; i++) {
+        if (expected_state->sequence[i] != state.sequence[i]) {
+            LOG_ERROR(
+                "test_lehmer_state_init: Expected sequence[%u] = %d, "
+                "but got %d\n",
+                i,
+                expected_state->sequence[i],
+                state.sequence[i]
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    teardown_lehmer_state(expected_state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_state_lean(void) {
+    bool passed = true;
+
+    lehmer_state_t* state = lehmer_state_create_lean(LEHMER_SEED);
+
+    // Test: a lean state holds exactly one seed
+    if (1 != state->length) {
+        LOG_ERROR(
+            "test_lehmer_state_lean: Expected state->length = 1, "
+            "but got %u\n",
+            state->length
+        );
+        passed = false;
+    }
+
+    // Test: lean draws match the raw recurrence
+    int32_t expected_seed = LEHMER_SEED;
+    for (uint32_t i = 0; i < 100; i++) {
+        expected_seed = lehmer_generate_modulo(expected_seed);
+        float expected_output = lehmer_seed_normalize_to_float(expected_seed);
+        float current_output = lehmer_random_lean(state);
+
+        if (!float_is_close(expected_output, current_output, 7)) {
+            LOG_ERROR(
+                "test_lehmer_state_lean: Expected output %.7f, "
+                "but got %.7f\n",
+                expected_output,
+                current_output
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer64_random(void) {
+    bool passed = true;
+
+    lehmer64_state_t* state = lehmer64_state_create(1);
+
+    // Test: f(1) == a (one step from seed 1 yields the multiplier)
+    uint64_t current_seed = lehmer64_generate_modulo(state->seed);
+    if (LEHMER64_MULTIPLIER != current_seed) {
+        LOG_ERROR(
+            "test_lehmer64_random: Expected seed %llu, but got %llu\n",
+            (unsigned long long) LEHMER64_MULTIPLIER,
+            (unsigned long long) current_seed
+        );
+        passed = false;
+    }
+
+    // Test: draws stay within the open unit interval
+    for (uint32_t i = 0; i < 1000; i++) {
+        double output = lehmer64_random(state);
+        if (0.0 >= output || 1.0 <= output) {
+            LOG_ERROR(
+                "test_lehmer64_random: Expected output in (0, 1), "
+                "but got %.15f\n",
+                output
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    lehmer64_state_free(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_state_jump(void) {
+    bool passed = true;
+    const uint64_t steps = 1000;
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    // fast-forward the current seed by hand (brute force)
+    int32_t expected_seed = lehmer_get_current_seed(state);
+    for (uint64_t i = 0; i < steps; i++) {
+        expected_seed = lehmer_generate_modulo(expected_seed);
+    }
+
+    // jump ahead in O(log k) and compare against the brute-forced seed
+    lehmer_state_jump(state, steps);
+    int32_t current_seed = lehmer_get_initial_seed(state);
+    if (expected_seed != current_seed) {
+        LOG_ERROR(
+            "test_lehmer_state_jump: Expected seed %d, but got %d\n",
+            expected_seed,
+            current_seed
+        );
+        lehmer_state_print(state);
+        passed = false;
+    }
+
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_at(void) {
+    bool passed = true;
+    const uint64_t steps = 1000;
+
+    // step 0 is the seed itself
+    if (LEHMER_SEED != lehmer_at(LEHMER_SEED, 0)) {
+        LOG_ERROR(
+            "test_lehmer_at: Expected step 0 to return the seed %d, "
+            "but got %d\n",
+            LEHMER_SEED,
+            lehmer_at(LEHMER_SEED, 0)
+        );
+        passed = false;
+    }
+
+    // stateless random access matches the sequential recurrence
+    int32_t expected_seed = LEHMER_SEED;
+    for (uint64_t i = 1; i <= steps; i++) {
+        expected_seed = lehmer_generate_modulo(expected_seed);
+
+        int32_t current_seed = lehmer_at(LEHMER_SEED, i);
+        if (expected_seed != current_seed) {
+            LOG_ERROR(
+                "test_lehmer_at: Expected seed %d at step %lu, "
+                "but got %d\n",
+                expected_seed,
+                i,
+                current_seed
+            );
+            passed = false;
+            break;
+        }
+    }
+
+    // exponents reduce modulo the period: a full cycle returns the seed
+    const uint64_t period = (uint64_t) LEHMER_MODULUS - 1;
+    if (LEHMER_SEED != lehmer_at(LEHMER_SEED, period)) {
+        LOG_ERROR(
+            "test_lehmer_at: Expected a full period to return the seed %d, "
+            "but got %d\n",
+            LEHMER_SEED,
+            lehmer_at(LEHMER_SEED, period)
+        );
+        passed = false;
+    }
+    if (lehmer_at(LEHMER_SEED, 5) != lehmer_at(LEHMER_SEED, period + 5)) {
+        LOG_ERROR(
+            "test_lehmer_at: Expected step 5 and step period + 5 to match\n"
+        );
+        passed = false;
+    }
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_lehmer_random_fill(void) {
+    bool passed = true;
+    float buffer[10] = {0.0f};
+
+    lehmer_state_t* state = setup_lehmer_state();
+
+    // fill a small buffer in one call
+    lehmer_random_fill(state, buffer, 10);
+
+    // replay the recurrence by hand from the same starting seed
+    lehmer_state_t* expected_state = setup_lehmer_state();
+    int32_t seed = lehmer_get_current_seed(expected_state);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        seed = lehmer_generate_modulo(seed);
+        float expected_output = lehmer_seed_normalize_to_float(seed);
+
+        if (!float_is_close(expected_output, buffer[i], 7)) {
+            LOG_ERROR(
+                "test_lehmer_random_fill: Expected buffer[%u] = %.7f, "
+                "but got %.7f\n",
+                i,
+                expected_output,
+                buffer[i]
+            );
+            passed = false;
+        }
+    }
+
+    // the final seed is written back so the stream continues in place
+    if (seed != lehmer_get_current_seed(state)) {
+        LOG_ERROR(
+            "test_lehmer_random_fill: Expected current seed %d, but got %d\n",
+            seed,
+            lehmer_get_current_seed(state)
+        );
+        lehmer_state_print(state);
+        passed = false;
+    }
+
+    teardown_lehmer_state(expected_state);
+    teardown_lehmer_state(state);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
 /**
  * @brief Tests if the Lehmer RNG generates numbers in its full period
  *
@@ -441,6 +1643,30 @@ int main(void) {
     passed |= test_lehmer_seed_normalize();
     passed |= test_random_seed_and_normalize();
     passed |= test_seed_generation();
+    passed |= test_lehmer_state_jump();
+    passed |= test_lehmer_at();
+    passed |= test_lehmer_random_fill();
+    passed |= test_lehmer64_random();
+    passed |= test_lehmer_state_lean();
+    passed |= test_lehmer_state_init();
+    passed |= test_lehmer_binomial();
+    passed |= test_lehmer_normal_exponential();
+    passed |= test_lehmer_stream_pool();
+    passed |= test_lehmer_bank();
+    passed |= test_lehmer_stream_to_fd();
+    passed |= test_lehmer_shuffle();
+    passed |= test_lehmer_sample_k();
+    passed |= test_lehmer_generate_stream();
+    passed |= test_lehmer_replay();
+    passed |= test_lehmer_position_ring();
+    passed |= test_lehmer_next();
+#ifdef LEHMER_ENABLE_STATS
+    passed |= test_lehmer_stats();
+#endif
+    passed |= test_lehmer_seed_normalize_to_double();
+    passed |= test_lehmer_state_snapshot();
+    passed |= test_lehmer_random_bounded();
+    passed |= test_lehmer_state_lazy();
     // passed |= test_jump_state();
     // passed |= test_full_period();
     printf("\n");
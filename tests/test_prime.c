@@ -9,17 +9,265 @@
  *   - I'll admit this is weird, but the shell and cmake test for this.
  */
 
+#include "logger.h"
 #include "prime.h"
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
 
 int test_prime_sample_create(void) {
-    return 0; // Success
+    bool passed = true;
+
+    // there are exactly 25 primes up to 100
+    const uint32_t expected_size = 25;
+    const int32_t expected_head[] = {2, 3, 5, 7, 11};
+    const int32_t expected_tail = 97;
+
+    prime_sample_t* sample = prime_sample_create(100);
+
+    if (expected_size != sample->size) {
+        LOG_ERROR(
+            "test_prime_sample_create: Expected sample->size = %u, "
+            "but got %u\n",
+            expected_size,
+            sample->size
+        );
+        passed = false;
+    }
+
+    for (uint32_t i = 0; i < 5; i++) {
+        if (expected_head[i] != sample->data[i]) {
+            LOG_ERROR(
+                "test_prime_sample_create: Expected data[%u] = %d, "
+                "but got %d\n",
+                i,
+                expected_head[i],
+                sample->data[i]
+            );
+            passed = false;
+        }
+    }
+
+    if (expected_tail != sample->data[sample->size - 1]) {
+        LOG_ERROR(
+            "test_prime_sample_create: Expected last prime %d, but got %d\n",
+            expected_tail,
+            sample->data[sample->size - 1]
+        );
+        passed = false;
+    }
+
+    prime_sample_free(sample);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_prime_miller_rabin_batch(void) {
+    bool passed = true;
+
+    // mix small cases, Mersenne primes, and values above the old 32-bit
+    // squaring overflow threshold (~46341)
+    const uint32_t candidates[]
+        = {1, 2, 3, 4, 61, 221, 2147483647, 2147483649U, 4294967291U};
+    const uint8_t expected[] = {0, 1, 1, 0, 1, 0, 1, 0, 1};
+    const size_t size = sizeof(candidates) / sizeof(candidates[0]);
+    uint8_t out[sizeof(candidates) / sizeof(candidates[0])] = {0};
+
+    prime_miller_rabin_batch(candidates, size, out);
+
+    for (size_t i = 0; i < size; i++) {
+        if (expected[i] != out[i]) {
+            LOG_ERROR(
+                "test_prime_miller_rabin_batch: Expected out[%zu] = %u "
+                "for candidate %u, but got %u\n",
+                i,
+                expected[i],
+                candidates[i],
+                out[i]
+            );
+            passed = false;
+        }
+    }
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_prime_modexp(void) {
+    bool passed = true;
+
+    // exercise a large odd modulus that the 32-bit path cannot handle
+    const uint32_t m = 2147483647; // 2^31 - 1
+    const uint32_t a = 48271;
+    const uint32_t b = 1048576; // 2^20
+
+    prime_modexp_ctx_t ctx;
+    if (!prime_modexp_ctx_init(&ctx, m)) {
+        LOG_ERROR("test_prime_modexp: Failed to initialize context\n");
+        return 1;
+    }
+
+    // reference: plain square-and-multiply with 64-bit intermediates
+    uint64_t expected = 1;
+    uint64_t base = a;
+    uint32_t e = b;
+    while (0 < e) {
+        if (e & 1) {
+            expected = (expected * base) % m;
+        }
+        e >>= 1;
+        base = (base * base) % m;
+    }
+
+    uint32_t current = prime_modexp(&ctx, a, b);
+    if ((uint32_t) expected != current) {
+        LOG_ERROR(
+            "test_prime_modexp: Expected %u^%u mod %u = %u, but got %u\n",
+            a,
+            b,
+            m,
+            (uint32_t) expected,
+            current
+        );
+        passed = false;
+    }
+
+    // edge cases: zero exponent and base reduction
+    if (1 != prime_modexp(&ctx, a, 0)) {
+        LOG_ERROR("test_prime_modexp: Expected a^0 = 1\n");
+        passed = false;
+    }
+    if (prime_modexp(&ctx, m + 5, 1) != 5) {
+        LOG_ERROR("test_prime_modexp: Expected (m + 5)^1 = 5\n");
+        passed = false;
+    }
+
+    // even moduli are rejected
+    prime_modexp_ctx_t even_ctx;
+    if (prime_modexp_ctx_init(&even_ctx, 100)) {
+        LOG_ERROR("test_prime_modexp: Expected even modulus to fail\n");
+        passed = false;
+    }
+
+    // moduli near 2^32 make t + q * m carry out of 64 bits inside the
+    // reduction; 2^31 - 1 alone can never trigger it
+    const uint32_t large_m[] = {4294967291U, 4294967279U, 3221225473U};
+    const uint32_t large_a[] = {4294966291U, 48271, 2147483647U};
+    const uint32_t large_b[] = {2, 1048576, 65537};
+    for (size_t i = 0; i < 3; i++) {
+        prime_modexp_ctx_t large_ctx;
+        if (!prime_modexp_ctx_init(&large_ctx, large_m[i])) {
+            LOG_ERROR("test_prime_modexp: Failed to initialize m = %u\n",
+                      large_m[i]);
+            passed = false;
+            continue;
+        }
+
+        for (size_t j = 0; j < 3; j++) {
+            // reference: square-and-multiply in 64-bit; both operands
+            // stay below 2^32, so the products cannot overflow
+            uint64_t reference = 1;
+            uint64_t large_base = large_a[j] % large_m[i];
+            uint32_t exponent = large_b[j];
+            while (0 < exponent) {
+                if (exponent & 1) {
+                    reference = (reference * large_base) % large_m[i];
+                }
+                exponent >>= 1;
+                large_base = (large_base * large_base) % large_m[i];
+            }
+
+            uint32_t large_current
+                = prime_modexp(&large_ctx, large_a[j], large_b[j]);
+            if ((uint32_t) reference != large_current) {
+                LOG_ERROR(
+                    "test_prime_modexp: Expected %u^%u mod %u = %u, "
+                    "but got %u\n",
+                    large_a[j],
+                    large_b[j],
+                    large_m[i],
+                    (uint32_t) reference,
+                    large_current
+                );
+                passed = false;
+            }
+        }
+    }
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
+}
+
+int test_prime_iter(void) {
+    bool passed = true;
+
+    // iterate several segments and compare against the one-shot sieve
+    const uint32_t limit = 1000000;
+    prime_sample_t* sample = prime_sample_create(limit);
+    prime_iter_t* iter = prime_iter_create(limit);
+
+    int32_t* batch = NULL;
+    uint32_t count = 0;
+    uint32_t total = 0;
+    uint32_t segments = 0;
+
+    while (prime_iter_next_segment(iter, &batch, &count)) {
+        for (uint32_t i = 0; i < count && passed; i++) {
+            if (sample->data[total + i] != batch[i]) {
+                LOG_ERROR(
+                    "test_prime_iter: Expected prime %d at index %u, "
+                    "but got %d\n",
+                    sample->data[total + i],
+                    total + i,
+                    batch[i]
+                );
+                passed = false;
+            }
+        }
+        total += count;
+        segments++;
+    }
+
+    if (sample->size != total) {
+        LOG_ERROR(
+            "test_prime_iter: Expected %u primes, but got %u\n",
+            sample->size,
+            total
+        );
+        passed = false;
+    }
+
+    // 10^6 candidates at 2^18 per segment is four windows
+    if (4 != segments) {
+        LOG_ERROR(
+            "test_prime_iter: Expected 4 segments, but got %u\n", segments
+        );
+        passed = false;
+    }
+
+    // an exhausted iterator keeps reporting the end of the range
+    if (prime_iter_next_segment(iter, &batch, &count) || 0 != count) {
+        LOG_ERROR("test_prime_iter: Expected exhaustion after the range\n");
+        passed = false;
+    }
+
+    prime_iter_free(iter);
+    prime_sample_free(sample);
+
+    printf("%s", passed ? "." : "x");
+    return passed ? 0 : 1;
 }
 
 int main(void) {
     int result = 0; // Assume success
 
+    result |= test_prime_sample_create();
+    result |= test_prime_miller_rabin_batch();
+    result |= test_prime_modexp();
+    result |= test_prime_iter();
+    printf("\n");
+
     return result; // success
 }